@@ -507,6 +507,7 @@ static void PrintCommandLineHelp(const char* progname)
 	std::fprintf(stderr, "  -logfile <filename>: Writes emu log to filename.\n");
 	std::fprintf(stderr, "  -noshadercache: Disables the shader cache (useful for parallel runs).\n");
 	std::fprintf(stderr, "  -perf: Enable frame timing performance stats.\n");
+	std::fprintf(stderr, "  -capture <filename>: Renders the dump to a video file, as fast as the encoder allows.\n");
 	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
 						 "    parameters make up the filename. Use when the filename contains\n"
 						 "    spaces or starts with a dash.\n");
@@ -799,6 +800,15 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 				s_perf_enable = true;
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-capture"))
+			{
+				params.capture_filename = StringUtil::StripWhitespace(argv[++i]);
+				params.offline_render = true;
+
+				// Dumps don't drive the SPU2, so there's no audio to capture.
+				s_settings_interface.SetBoolValue("EmuCore/GS", "EnableAudioCapture", false);
+				continue;
+			}
 			else if (CHECK_ARG("-debugdevice"))
 			{
 				Console.WriteLn("Enable debug device");
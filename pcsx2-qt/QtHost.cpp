@@ -2106,6 +2106,8 @@ void QtHost::PrintCommandLineHelp(const std::string_view progname)
 	std::fprintf(stderr, "  -debugger: Open debugger and break on entry point.\n");
 	std::fprintf(stderr, "  -turbo: Enters turbo (fast forward) mode after starting.\n");
 	std::fprintf(stderr, "  -unlimited: Enters unlimited (fast forward) mode after starting.\n");
+	std::fprintf(stderr, "  -capture <filename>: Starts a video capture to filename once the game is on screen.\n");
+	std::fprintf(stderr, "  -offlinerender: Runs unthrottled, with the capture encoder setting the pace. Use with -capture.\n");
 #ifdef ENABLE_RAINTEGRATION
 	std::fprintf(stderr, "  -raintegration: Use RAIntegration instead of built-in achievement support.\n");
 #endif
@@ -2269,6 +2271,16 @@ bool QtHost::ParseCommandLineOptions(const QStringList& args, std::shared_ptr<VM
 				AutoBoot(autoboot)->start_unlimited = true;
 				continue;
 			}
+			else if (CHECK_ARG_PARAM(QStringLiteral("-capture")))
+			{
+				AutoBoot(autoboot)->capture_filename = (++it)->toStdString();
+				continue;
+			}
+			else if (CHECK_ARG(QStringLiteral("-offlinerender")))
+			{
+				AutoBoot(autoboot)->offline_render = true;
+				continue;
+			}
 #ifdef ENABLE_RAINTEGRATION
 			else if (CHECK_ARG(QStringLiteral("-raintegration")))
 			{
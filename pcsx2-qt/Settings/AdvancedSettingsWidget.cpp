@@ -21,6 +21,7 @@ AdvancedSettingsWidget::AdvancedSettingsWidget(SettingsWindow* settings_dialog,
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.eeINTCSpinDetection, "EmuCore/Speedhacks", "IntcStat", true);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.eeWaitLoopDetection, "EmuCore/Speedhacks", "WaitLoop", true);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.eeFastmem, "EmuCore/CPU/Recompiler", "EnableFastmem", true);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.eeSubPageSMC, "EmuCore/CPU/Recompiler", "EnableSubPageSMC", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.pauseOnTLBMiss, "EmuCore/CPU/Recompiler", "PauseOnTLBMiss", false);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.extraMemory, "EmuCore/CPU", "ExtraMemory", false);
 
@@ -28,6 +29,8 @@ AdvancedSettingsWidget::AdvancedSettingsWidget(SettingsWindow* settings_dialog,
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.vu1Recompiler, "EmuCore/CPU/Recompiler", "EnableVU1", true);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.vuFlagHack, "EmuCore/Speedhacks", "vuFlagHack", true);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.instantVU1, "EmuCore/Speedhacks", "vu1Instant", true);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.vuProgramCache, "EmuCore/CPU/Recompiler", "EnableVUProgramCache", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.vu1AsyncCompile, "EmuCore/CPU/Recompiler", "EnableVU1AsyncCompile", false);
 
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.eeRoundingMode, "EmuCore/CPU", "FPU.Roundmode", static_cast<int>(FPRoundMode::ChopZero));
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.eeDivRoundingMode, "EmuCore/CPU", "FPUDiv.Roundmode", static_cast<int>(FPRoundMode::Nearest));
@@ -91,6 +94,10 @@ AdvancedSettingsWidget::AdvancedSettingsWidget(SettingsWindow* settings_dialog,
 		//: "Backpatching" = To edit previously generated code to change what it does (in this case, we generate direct memory accesses, then backpatch them to jump to a fancier handler function when we realize they need the fancier handler function)
 		tr("Uses backpatching to avoid register flushing on every memory access."));
 
+	dialog()->registerWidgetHelp(m_ui.eeSubPageSMC, tr("Sub-Page Code Write Tracking"), tr("Unchecked"),
+		tr("When a game writes to a memory page holding code, only discards the code next to the written data instead of the whole page. "
+		   "Can reduce recompilation in games which keep data and code together. Requires Fast Memory Access."));
+
 	dialog()->registerWidgetHelp(m_ui.pauseOnTLBMiss, tr("Pause On TLB Miss"), tr("Unchecked"),
 		tr("Pauses the virtual machine when a TLB miss occurs, instead of ignoring it and continuing. Note that the VM will pause after the "
 		   "end of the block, not on the instruction which caused the exception. Refer to the console to see the address where the invalid "
@@ -126,6 +133,14 @@ AdvancedSettingsWidget::AdvancedSettingsWidget(SettingsWindow* settings_dialog,
 		//: mVU = PCSX2's recompiler for VU (Vector Unit) code (full name: microVU)
 		m_ui.vuFlagHack, tr("mVU Flag Hack"), tr("Checked"), tr("Good speedup and high compatibility, may cause graphical errors."));
 
+	dialog()->registerWidgetHelp(m_ui.vuProgramCache, tr("Enable VU Program Cache"), tr("Unchecked"),
+		tr("Stores the game's VU microprograms in the cache directory, and recompiles them when the game starts. "
+		   "Reduces stutter the first time a scene is shown, at the cost of a longer boot."));
+
+	dialog()->registerWidgetHelp(m_ui.vu1AsyncCompile, tr("Background VU1 Compilation"), tr("Unchecked"),
+		tr("Compiles new VU1 microprograms on a separate thread, and runs them on the interpreter until they are ready. "
+		   "Reduces stutter when MTVU is disabled, but the interpreter is slower and may behave slightly differently. Has no effect with MTVU."));
+
 	dialog()->registerWidgetHelp(m_ui.iopRecompiler, tr("Enable Recompiler"), tr("Checked"),
 		tr("Performs just-in-time binary translation of 32-bit MIPS-I machine code to x86."));
 
@@ -41,6 +41,9 @@ AudioSettingsWidget::AudioSettingsWidget(SettingsWindow* settings_dialog, QWidge
 				static_cast<Pcsx2Config::SPU2Options::SPU2SyncMode>(i))));
 	}
 
+	for (u32 i = 0; i < static_cast<u32>(AudioStretchMode::Count); i++)
+		m_ui.stretchMode->addItem(QString::fromUtf8(AudioStream::GetStretchModeDisplayName(static_cast<AudioStretchMode>(i))));
+
 	SettingWidgetBinder::BindWidgetToEnumSetting(sif, m_ui.audioBackend, "SPU2/Output", "Backend",
 		&AudioStream::ParseBackendName, &AudioStream::GetBackendName,
 		Pcsx2Config::SPU2Options::DEFAULT_BACKEND);
@@ -50,11 +53,17 @@ AudioSettingsWidget::AudioSettingsWidget(SettingsWindow* settings_dialog, QWidge
 	SettingWidgetBinder::BindWidgetToEnumSetting(sif, m_ui.syncMode, "SPU2/Output", "SyncMode",
 		&Pcsx2Config::SPU2Options::ParseSyncMode, &Pcsx2Config::SPU2Options::GetSyncModeName,
 		Pcsx2Config::SPU2Options::DEFAULT_SYNC_MODE);
+	SettingWidgetBinder::BindWidgetToEnumSetting(sif, m_ui.stretchMode, "SPU2/Output", "StretchMode",
+		&AudioStream::ParseStretchMode, &AudioStream::GetStretchModeName,
+		AudioStreamParameters::DEFAULT_STRETCH_MODE);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.bufferMS, "SPU2/Output", "BufferMS",
 		AudioStreamParameters::DEFAULT_BUFFER_MS);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.adaptiveBuffer, "SPU2/Output", "AdaptiveBuffer",
+		AudioStreamParameters::DEFAULT_ADAPTIVE_BUFFER);
 	SettingWidgetBinder::BindWidgetToIntSetting(sif, m_ui.outputLatencyMS, "SPU2/Output", "OutputLatencyMS",
 		AudioStreamParameters::DEFAULT_OUTPUT_LATENCY_MS);
 	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.outputLatencyMinimal, "SPU2/Output", "OutputLatencyMinimal", false);
+	SettingWidgetBinder::BindWidgetToBoolSetting(sif, m_ui.threadedOutput, "SPU2/Output", "ThreadedOutput", false);
 	connect(m_ui.audioBackend, &QComboBox::currentIndexChanged, this, &AudioSettingsWidget::updateDriverNames);
 	connect(m_ui.expansionMode, &QComboBox::currentIndexChanged, this, &AudioSettingsWidget::onExpansionModeChanged);
 	connect(m_ui.expansionSettings, &QToolButton::clicked, this, &AudioSettingsWidget::onExpansionSettingsClicked);
@@ -118,6 +127,14 @@ AudioSettingsWidget::AudioSettingsWidget(SettingsWindow* settings_dialog, QWidge
 		tr("When the emulation isn't running at 100% speed, adjusts the tempo of the audio which produces much nicer sound during fast-forward/slowdown."));
 	dialog()->registerWidgetHelp(m_ui.stretchSettings, tr("Stretch Settings"), tr("N/A"),
 		tr("These settings fine-tune the behavior of the SoundTouch audio time stretcher when running outside of 100% speed."));
+	dialog()->registerWidgetHelp(m_ui.stretchMode, tr("Stretch Engine"), tr("SoundTouch"),
+		tr("Selects the algorithm used to keep audio in sync when time stretching. The lightweight engine uses less CPU."));
+	dialog()->registerWidgetHelp(m_ui.adaptiveBuffer, tr("Adaptive Buffer Size"), tr("Unchecked"),
+		tr("When enabled with time stretching, the buffer shrinks to what the host API needs, using the buffer size as an "
+		   "upper limit."));
+	dialog()->registerWidgetHelp(m_ui.threadedOutput, tr("Threaded Output"), tr("Unchecked"),
+		tr("Runs audio expansion and time stretching on a separate thread, so the emulation thread only has to mix. "
+		   "Can improve performance on CPUs with spare cores."));
 	dialog()->registerWidgetHelp(m_ui.resetStandardVolume, tr("Reset Standard Volume"), tr("N/A"),
 		dialog()->isPerGameSettings() ? tr("Resets standard volume back to the global/inherited setting.") :
 										tr("Resets standard volume back to the default."));
@@ -163,7 +180,10 @@ void AudioSettingsWidget::onSyncModeChanged()
 						Pcsx2Config::SPU2Options::GetSyncModeName(Pcsx2Config::SPU2Options::DEFAULT_SYNC_MODE))
 				.c_str())
 			.value_or(Pcsx2Config::SPU2Options::DEFAULT_SYNC_MODE);
-	m_ui.stretchSettings->setEnabled(sync_mode == Pcsx2Config::SPU2Options::SPU2SyncMode::TimeStretch);
+	const bool time_stretch = (sync_mode == Pcsx2Config::SPU2Options::SPU2SyncMode::TimeStretch);
+	m_ui.stretchSettings->setEnabled(time_stretch);
+	m_ui.stretchMode->setEnabled(time_stretch);
+	m_ui.adaptiveBuffer->setEnabled(time_stretch);
 }
 
 AudioBackend AudioSettingsWidget::getEffectiveBackend() const
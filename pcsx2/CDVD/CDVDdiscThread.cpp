@@ -3,6 +3,7 @@
 
 #include "CDVDdiscReader.h"
 #include "CDVD/CDVD.h"
+#include "PerformanceMetrics.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -295,8 +296,12 @@ u8* cdvdGetSector(u32 sector, s32 mode)
 	u32 sector_block = sector & ~(sectors_per_read - 1);
 
 	if (!cdvdCacheFetch(sector_block, buffer))
+	{
+		// Not prefetched, so the drive read blocks the caller.
+		PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::DiscRead);
 		if (cdvdReadBlockOfSectors(sector_block, buffer))
 			cdvdCacheUpdate(sector_block, buffer);
+	}
 
 	if (src->GetMediaType() >= 0)
 	{
@@ -3,6 +3,7 @@
 
 #include "ThreadedFileReader.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 
 #include "common/Error.h"
 #include "common/HostSys.h"
@@ -375,6 +376,11 @@ int ThreadedFileReader::FinishRead(void)
 	if (m_requestPtr.load(std::memory_order_acquire) == nullptr)
 		return m_amtRead;
 	std::unique_lock<std::mutex> lock(m_mtx);
+	if (!m_requestPtr.load(std::memory_order_acquire))
+		return m_amtRead;
+
+	// Only reads the caller has to block on can cause a stutter.
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::DiscRead);
 	while (m_requestPtr.load(std::memory_order_acquire))
 		m_condition.wait(lock);
 	return m_amtRead;
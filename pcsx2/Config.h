@@ -187,6 +187,7 @@ enum class SpeedHack
 	InstantVU1,
 	MTVU,
 	EECycleRate,
+	MTVU0,
 	MaxCount,
 };
 
@@ -654,6 +655,12 @@ struct Pcsx2Config
 			EnableEECache : 1;
 		bool
 			EnableFastmem : 1;
+		bool
+			EnableSubPageSMC : 1;
+		bool
+			EnableVUProgramCache : 1;
+		bool
+			EnableVU1AsyncCompile : 1;
 		bool
 			PauseOnTLBMiss : 1;
 		BITFIELD_END
@@ -994,6 +1001,7 @@ struct Pcsx2Config
 		u32 StandardVolume = 100;
 		u32 FastForwardVolume = 100;
 		bool OutputMuted = false;
+		bool ThreadedOutput = false;
 
 		AudioBackend Backend = DEFAULT_BACKEND;
 		SPU2SyncMode SyncMode = DEFAULT_SYNC_MODE;
@@ -1131,7 +1139,8 @@ struct Pcsx2Config
 			WaitLoop : 1, // enables constant loop detection and fast-forwarding
 			vuFlagHack : 1, // microVU specific flag hack
 			vuThread : 1, // Enable Threaded VU1
-			vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+			vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+			vu0Thread : 1; // Run VU0 micro programs on a thread (experimental, GameDB opt-in)
 		BITFIELD_END
 
 		s8 EECycleRate; // EE cycle rate selector (1.0, 1.5, 2.0)
@@ -1184,15 +1193,21 @@ struct Pcsx2Config
 	// ------------------------------------------------------------------------
 	struct EmulationSpeedOptions
 	{
+		static constexpr int MAX_RUN_AHEAD_FRAMES = 4;
+
 		BITFIELD32()
 		bool SyncToHostRefreshRate : 1;
 		bool UseVSyncForTiming : 1;
+		bool LatencyReducedPacing : 1;
 		BITFIELD_END
 
 		float NominalScalar{1.0f};
 		float TurboScalar{2.0f};
 		float SlomoScalar{0.5f};
 
+		// Frames emulated ahead of the one shown and rolled back each frame, to hide the game's own input lag.
+		int RunAheadFrames = 0;
+
 		EmulationSpeedOptions();
 
 		void LoadSave(SettingsWrapper& wrap);
@@ -1488,8 +1503,12 @@ namespace EmuFolders
 #ifdef _M_X86 // TODO: Remove me once EE/VU/IOP recs are added.
 #define REC_VU1 (EmuConfig.Cpu.Recompiler.EnableVU1)
 #define THREAD_VU1 (REC_VU1 && EmuConfig.Speedhacks.vuThread)
+// The VU0 thread needs the EE rec's COP2 syncs and MTVU, and can't apply EE cycle skipping from the worker.
+#define THREAD_VU0 (EmuConfig.Cpu.Recompiler.EnableEE && EmuConfig.Cpu.Recompiler.EnableVU0 && THREAD_VU1 && \
+	EmuConfig.Speedhacks.vu0Thread && EmuConfig.Speedhacks.EECycleSkip == 0)
 #else
 #define THREAD_VU1 false
+#define THREAD_VU0 false
 #define REC_VU1 false
 #endif
 #define INSTANT_VU1 (EmuConfig.Speedhacks.vu1Instant)
@@ -1497,6 +1516,7 @@ namespace EmuFolders
 #define CHECK_CACHE (EmuConfig.Cpu.Recompiler.EnableEECache)
 #define CHECK_IOPREC (EmuConfig.Cpu.Recompiler.EnableIOP)
 #define CHECK_FASTMEM (EmuConfig.Cpu.Recompiler.EnableEE && EmuConfig.Cpu.Recompiler.EnableFastmem)
+#define CHECK_SUBPAGE_SMC (CHECK_FASTMEM && EmuConfig.Cpu.Recompiler.EnableSubPageSMC)
 #define CHECK_EXTRAMEM (memGetExtraMemMode())
 
 //------------ SPECIAL GAME FIXES!!! ---------------
@@ -12,8 +12,10 @@
 #include "GS.h"
 #include "GS/GS.h"
 #include "MTGS.h"
+#include "MTVU.h"
 #include "PerformanceMetrics.h"
 #include "Patch.h"
+#include "Tracing.h"
 #include "ps2/HwInternal.h"
 #include "SIO/Sio.h"
 #include "SPU2/spu2.h"
@@ -484,15 +486,30 @@ static __fi void DoFMVSwitch()
 	}
 }
 
+// Host time the EE resumed after the last throttle, for the frame zone in traces.
+static u64 s_trace_frame_start = 0;
+
 static __fi void VSyncStart(u64 sCycle)
 {
+	if (s_trace_frame_start != 0 && Tracing::IsEnabled()) [[unlikely]]
+		Tracing::RecordZone("EE Frame", s_trace_frame_start, GetCPUTicks());
+
+	// Let MTVU work through anything still batched while we throttle.
+	if (THREAD_VU1)
+		vu1Thread.KickPending();
+
 	// End-of-frame tasks.
 	DoFMVSwitch();
 	VMManager::Internal::VSyncOnCPUThread();
 
-	// Don't bother throttling if we're going to pause.
-	if (!VMManager::Internal::IsExecutionInterrupted())
+	// Don't bother throttling if we're going to pause, or nobody will see the frame.
+	if (!VMManager::Internal::IsExecutionInterrupted() && !VMManager::Internal::IsFrameHidden())
+	{
+		TRACE_ZONE("Throttle");
 		VMManager::Internal::Throttle();
+	}
+
+	s_trace_frame_start = Tracing::IsEnabled() ? GetCPUTicks() : 0;
 
 	gsPostVsyncStart(); // MUST be after framelimit; doing so before causes funk with frame times!
 
@@ -331,7 +331,8 @@ void gsPostVsyncStart()
 
 	const bool registers_written = s_GSRegistersWritten;
 	s_GSRegistersWritten = false;
-	MTGS::PostVsyncStart(registers_written);
+	MTGS::PostVsyncStart(registers_written, VMManager::Internal::IsFrameHidden(),
+		VMManager::Internal::IsRunningAhead());
 }
 
 bool SaveStateBase::gsFreeze()
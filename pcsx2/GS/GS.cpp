@@ -433,7 +433,7 @@ void GSgifTransfer3(u8* mem, u32 size)
 	g_gs_renderer->Transfer<2>(const_cast<u8*>(mem), size);
 }
 
-void GSvsync(u32 field, bool registers_written)
+void GSvsync(u32 field, bool registers_written, bool hidden, bool run_ahead)
 {
 	// Update this here because we need to check if the pending draw affects the current frame, so our regs need to be updated.
 	g_gs_renderer->PCRTCDisplays.SetVideoMode(g_gs_renderer->GetVideoMode());
@@ -447,18 +447,18 @@ void GSvsync(u32 field, bool registers_written)
 	// Do not move the flush into the VSync() method. It's here because EE transfers
 	// get cleared in HW VSync, and may be needed for a buffered draw (FFX FMVs).
 	g_gs_renderer->Flush(GSState::VSYNC);
-	g_gs_renderer->VSync(field, registers_written, g_gs_renderer->IsIdleFrame());
+	g_gs_renderer->VSync(field, registers_written, g_gs_renderer->IsIdleFrame(), hidden, run_ahead);
 }
 
-int GSfreeze(FreezeAction mode, freezeData* data)
+int GSfreeze(FreezeAction mode, freezeData* data, u64* snapshot_id)
 {
 	if (mode == FreezeAction::Save)
 	{
-		return g_gs_renderer->Freeze(data, false);
+		return g_gs_renderer->Freeze(data, false, snapshot_id);
 	}
 	else if (mode == FreezeAction::Size)
 	{
-		return g_gs_renderer->Freeze(data, true);
+		return g_gs_renderer->Freeze(data, true, snapshot_id);
 	}
 	else // if (mode == FreezeAction::Load)
 	{
@@ -472,7 +472,7 @@ int GSfreeze(FreezeAction mode, freezeData* data)
 		if (GSCapture::IsCapturing())
 			GSCapture::Flush();
 
-		return g_gs_renderer->Defrost(data);
+		return g_gs_renderer->Defrost(data, snapshot_id ? *snapshot_id : 0);
 	}
 }
 
@@ -488,6 +488,11 @@ void GSStopGSDump()
 		g_gs_renderer->StopGSDump();
 }
 
+bool GSIsSnapshotPending()
+{
+	return GSRenderer::IsSnapshotPending();
+}
+
 bool GSBeginCapture(std::string filename)
 {
 	if (g_gs_renderer)
@@ -70,12 +70,13 @@ void GSgifTransfer(const u8* mem, u32 size);
 void GSgifTransfer1(u8* mem, u32 addr);
 void GSgifTransfer2(u8* mem, u32 size);
 void GSgifTransfer3(u8* mem, u32 size);
-void GSvsync(u32 field, bool registers_written);
-int GSfreeze(FreezeAction mode, freezeData* data);
+void GSvsync(u32 field, bool registers_written, bool hidden, bool run_ahead);
+int GSfreeze(FreezeAction mode, freezeData* data, u64* snapshot_id = nullptr);
 std::string GSGetBaseSnapshotFilename();
 std::string GSGetBaseVideoFilename();
 void GSQueueSnapshot(const std::string& path, u32 gsdump_frames = 0);
 void GSStopGSDump();
+bool GSIsSnapshotPending();
 bool GSBeginCapture(std::string filename);
 void GSEndCapture();
 void GSPresentCurrentFrame();
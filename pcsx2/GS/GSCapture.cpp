@@ -100,6 +100,8 @@ extern "C" {
 	X(av_frame_get_buffer) \
 	X(av_frame_free) \
 	X(av_frame_make_writable) \
+	X(av_frame_is_writable) \
+	X(av_frame_unref) \
 	X(av_strerror) \
 	X(av_reduce) \
 	X(av_dict_parse_string) \
@@ -117,11 +119,22 @@ extern "C" {
 	X(av_hwframe_ctx_init) \
 	X(av_hwframe_transfer_data) \
 	X(av_hwframe_get_buffer) \
+	X(av_buffer_create) \
 	X(av_buffer_ref) \
 	X(av_buffer_unref) \
 	X(av_get_pix_fmt_name)
 
+#if LIBSWSCALE_VERSION_MAJOR < 6
+#define SWSCALE_6_IMPORTS(X)
+#else
+#define SWSCALE_6_IMPORTS(X) \
+	X(sws_alloc_context) \
+	X(sws_init_context) \
+	X(sws_scale_frame)
+#endif
+
 #define VISIT_SWSCALE_IMPORTS(X) \
+	SWSCALE_6_IMPORTS(X) \
 	X(sws_getCachedContext) \
 	X(sws_scale) \
 	X(sws_freeContext)
@@ -137,6 +150,7 @@ namespace GSCapture
 {
 	static constexpr u32 NUM_FRAMES_IN_FLIGHT = 3;
 	static constexpr u32 MAX_PENDING_FRAMES = NUM_FRAMES_IN_FLIGHT * 2;
+	static constexpr u32 CONVERTED_FRAME_POOL_SIZE = 4;
 	static constexpr u32 AUDIO_BUFFER_SIZE = Common::AlignUpPow2((MAX_PENDING_FRAMES * 48000) / 60, AudioStream::CHUNK_SIZE);
 	static constexpr u32 AUDIO_CHANNELS = 2;
 
@@ -164,6 +178,8 @@ namespace GSCapture
 	static void EncoderThreadEntryPoint();
 	static void StartEncoderThread();
 	static void StopEncoderThread(std::unique_lock<std::mutex>& lock);
+	static AVFrame* GetConvertedVideoFrame();
+	static bool ConvertFrame(const PendingFrame& pf, AVFrame* dst);
 	static bool SendFrame(const PendingFrame& pf);
 	static bool ReceivePackets(AVCodecContext* codec_context, AVStream* stream, AVPacket* packet);
 	static bool ProcessAudioPackets(s64 video_pts);
@@ -180,10 +196,13 @@ namespace GSCapture
 
 	static AVCodecContext* s_video_codec_context = nullptr;
 	static AVStream* s_video_stream = nullptr;
-	static AVFrame* s_converted_video_frame = nullptr; // YUV
+	static std::array<AVFrame*, CONVERTED_FRAME_POOL_SIZE> s_converted_video_frames = {}; // YUV
+	static u32 s_converted_video_frame_pos = 0;
+	static AVFrame* s_source_video_frame = nullptr; // RGBA, wraps the mapped download texture
 	static AVFrame* s_hw_video_frame = nullptr;
 	static AVPacket* s_video_packet = nullptr;
 	static SwsContext* s_sws_context = nullptr;
+	static GSVector2i s_sws_source_size{};
 	static AVDictionary* s_video_codec_arguments = nullptr;
 	static AVBufferRef* s_video_hw_context = nullptr;
 	static AVBufferRef* s_video_hw_frames = nullptr;
@@ -572,22 +591,31 @@ bool GSCapture::BeginCapture(float fps, GSVector2i recommendedResolution, float
 		if (has_pixel_format_override)
 			sw_pix_fmt = s_video_codec_context->pix_fmt;
 
-		s_converted_video_frame = wrap_av_frame_alloc();
-		s_hw_video_frame = IsUsingHardwareVideoEncoding() ? wrap_av_frame_alloc() : nullptr;
-		if (!s_converted_video_frame || (IsUsingHardwareVideoEncoding() && !s_hw_video_frame))
+		// The encoder can hang on to a frame after avcodec_send_frame(), so convert into a small pool rather than
+		// copying the whole frame out from under it when we need to write the next one.
+		for (AVFrame*& frame : s_converted_video_frames)
 		{
-			LogAVError(AVERROR(ENOMEM), "Failed to allocate frame: ");
-			InternalEndCapture(lock);
-			return false;
+			frame = wrap_av_frame_alloc();
+			if (!frame)
+				break;
+
+			frame->format = sw_pix_fmt;
+			frame->width = s_video_codec_context->width;
+			frame->height = s_video_codec_context->height;
+			res = wrap_av_frame_get_buffer(frame, 0);
+			if (res < 0)
+			{
+				LogAVError(res, "av_frame_get_buffer() for converted frame failed: ");
+				InternalEndCapture(lock);
+				return false;
+			}
 		}
 
-		s_converted_video_frame->format = sw_pix_fmt;
-		s_converted_video_frame->width = s_video_codec_context->width;
-		s_converted_video_frame->height = s_video_codec_context->height;
-		res = wrap_av_frame_get_buffer(s_converted_video_frame, 0);
-		if (res < 0)
+		s_source_video_frame = wrap_av_frame_alloc();
+		s_hw_video_frame = IsUsingHardwareVideoEncoding() ? wrap_av_frame_alloc() : nullptr;
+		if (!s_converted_video_frames.back() || !s_source_video_frame || (IsUsingHardwareVideoEncoding() && !s_hw_video_frame))
 		{
-			LogAVError(res, "av_frame_get_buffer() for converted frame failed: ");
+			LogAVError(AVERROR(ENOMEM), "Failed to allocate frame: ");
 			InternalEndCapture(lock);
 			return false;
 		}
@@ -994,7 +1022,40 @@ void GSCapture::StopEncoderThread(std::unique_lock<std::mutex>& lock)
 	}
 }
 
-bool GSCapture::SendFrame(const PendingFrame& pf)
+AVFrame* GSCapture::GetConvertedVideoFrame()
+{
+	for (u32 i = 0; i < CONVERTED_FRAME_POOL_SIZE; i++)
+	{
+		AVFrame* frame = s_converted_video_frames[s_converted_video_frame_pos];
+		s_converted_video_frame_pos = (s_converted_video_frame_pos + 1) % CONVERTED_FRAME_POOL_SIZE;
+		if (wrap_av_frame_is_writable(frame))
+			return frame;
+	}
+
+	// Encoder is holding on to all of them. Give the oldest one fresh buffers, there's no point copying the old
+	// contents across when we're about to overwrite them.
+	AVFrame* frame = s_converted_video_frames[s_converted_video_frame_pos];
+	s_converted_video_frame_pos = (s_converted_video_frame_pos + 1) % CONVERTED_FRAME_POOL_SIZE;
+
+	const int format = frame->format;
+	const int width = frame->width;
+	const int height = frame->height;
+	wrap_av_frame_unref(frame);
+	frame->format = format;
+	frame->width = width;
+	frame->height = height;
+
+	const int res = wrap_av_frame_get_buffer(frame, 0);
+	if (res < 0)
+	{
+		LogAVError(res, "av_frame_get_buffer() for converted frame failed: ");
+		return nullptr;
+	}
+
+	return frame;
+}
+
+bool GSCapture::ConvertFrame(const PendingFrame& pf, AVFrame* dst)
 {
 	const AVPixelFormat source_format = AV_PIX_FMT_RGBA;
 	const u8* source_ptr = pf.tex->GetMapPointer();
@@ -1002,25 +1063,90 @@ bool GSCapture::SendFrame(const PendingFrame& pf)
 	const int source_height = static_cast<int>(pf.tex->GetHeight());
 	const int source_pitch = static_cast<int>(pf.tex->GetMapPitch());
 
-	// In case a previous frame is still using the frame.
-	wrap_av_frame_make_writable(s_converted_video_frame);
+#if LIBSWSCALE_VERSION_MAJOR >= 6
+	// sws_scale() only ever runs on the calling thread, so 4K conversion alone can eat most of a frame's budget.
+	// Set up a sliced context instead, and let swscale split the frame across its own worker threads.
+	if (!s_sws_context || s_sws_source_size != GSVector2i(source_width, source_height))
+	{
+		if (s_sws_context)
+			wrap_sws_freeContext(s_sws_context);
 
-	s_sws_context = wrap_sws_getCachedContext(s_sws_context, source_width, source_height, source_format, s_converted_video_frame->width,
-		s_converted_video_frame->height, static_cast<AVPixelFormat>(s_converted_video_frame->format), SWS_BICUBIC, nullptr, nullptr, nullptr);
+		s_sws_context = wrap_sws_alloc_context();
+		if (!s_sws_context)
+		{
+			Console.Error("sws_alloc_context() failed");
+			return false;
+		}
+
+		wrap_av_opt_set_int(s_sws_context, "srcw", source_width, 0);
+		wrap_av_opt_set_int(s_sws_context, "srch", source_height, 0);
+		wrap_av_opt_set_int(s_sws_context, "src_format", source_format, 0);
+		wrap_av_opt_set_int(s_sws_context, "dstw", dst->width, 0);
+		wrap_av_opt_set_int(s_sws_context, "dsth", dst->height, 0);
+		wrap_av_opt_set_int(s_sws_context, "dst_format", dst->format, 0);
+		wrap_av_opt_set_int(s_sws_context, "sws_flags", SWS_BICUBIC, 0);
+		wrap_av_opt_set_int(s_sws_context, "threads", 0, 0); // auto
+
+		const int res = wrap_sws_init_context(s_sws_context, nullptr, nullptr);
+		if (res < 0)
+		{
+			LogAVError(res, "sws_init_context() failed: ");
+			wrap_sws_freeContext(s_sws_context);
+			s_sws_context = nullptr;
+			return false;
+		}
+
+		s_sws_source_size = GSVector2i(source_width, source_height);
+	}
+
+	// Wrap the mapped texture in a buffer that doesn't own it, otherwise swscale takes its own copy of the source.
+	s_source_video_frame->buf[0] = wrap_av_buffer_create(const_cast<u8*>(source_ptr), source_pitch * source_height,
+		[](void*, u8*) {}, nullptr, AV_BUFFER_FLAG_READONLY);
+	if (!s_source_video_frame->buf[0])
+	{
+		LogAVError(AVERROR(ENOMEM), "av_buffer_create() failed: ");
+		return false;
+	}
+
+	s_source_video_frame->data[0] = const_cast<u8*>(source_ptr);
+	s_source_video_frame->linesize[0] = source_pitch;
+	s_source_video_frame->width = source_width;
+	s_source_video_frame->height = source_height;
+	s_source_video_frame->format = source_format;
+
+	const int res = wrap_sws_scale_frame(s_sws_context, dst, s_source_video_frame);
+	wrap_av_frame_unref(s_source_video_frame);
+	if (res < 0)
+	{
+		LogAVError(res, "sws_scale_frame() failed: ");
+		return false;
+	}
+#else
+	s_sws_context = wrap_sws_getCachedContext(s_sws_context, source_width, source_height, source_format, dst->width, dst->height,
+		static_cast<AVPixelFormat>(dst->format), SWS_BICUBIC, nullptr, nullptr, nullptr);
 	if (!s_sws_context)
 	{
 		Console.Error("sws_getCachedContext() failed");
 		return false;
 	}
 
-	wrap_sws_scale(s_sws_context, reinterpret_cast<const u8**>(&source_ptr), &source_pitch, 0, source_height, s_converted_video_frame->data,
-		s_converted_video_frame->linesize);
+	wrap_sws_scale(s_sws_context, reinterpret_cast<const u8**>(&source_ptr), &source_pitch, 0, source_height, dst->data, dst->linesize);
+#endif
 
-	AVFrame* frame_to_send = s_converted_video_frame;
+	return true;
+}
+
+bool GSCapture::SendFrame(const PendingFrame& pf)
+{
+	AVFrame* const converted_frame = GetConvertedVideoFrame();
+	if (!converted_frame || !ConvertFrame(pf, converted_frame))
+		return false;
+
+	AVFrame* frame_to_send = converted_frame;
 	if (IsUsingHardwareVideoEncoding())
 	{
 		// Need to transfer the frame to hardware.
-		const int res = wrap_av_hwframe_transfer_data(s_hw_video_frame, s_converted_video_frame, 0);
+		const int res = wrap_av_hwframe_transfer_data(s_hw_video_frame, converted_frame, 0);
 		if (res < 0)
 		{
 			LogAVError(res, "av_hwframe_transfer_data() failed: ");
@@ -1319,10 +1445,17 @@ void GSCapture::InternalEndCapture(std::unique_lock<std::mutex>& lock)
 		wrap_sws_freeContext(s_sws_context);
 		s_sws_context = nullptr;
 	}
+	s_sws_source_size = {};
 	if (s_video_packet)
 		wrap_av_packet_free(&s_video_packet);
-	if (s_converted_video_frame)
-		wrap_av_frame_free(&s_converted_video_frame);
+	for (AVFrame*& frame : s_converted_video_frames)
+	{
+		if (frame)
+			wrap_av_frame_free(&frame);
+	}
+	s_converted_video_frame_pos = 0;
+	if (s_source_video_frame)
+		wrap_av_frame_free(&s_source_video_frame);
 	if (s_hw_video_frame)
 		wrap_av_frame_free(&s_hw_video_frame);
 	if (s_video_hw_frames)
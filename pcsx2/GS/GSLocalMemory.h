@@ -474,6 +474,9 @@ public:
 
 	GSClut m_clut;
 
+	/// One bit per page written since the last ClearDirtyPages(), lets snapshots skip untouched memory.
+	std::array<u32, GS_MAX_PAGES / 32> m_dirty_pages = {};
+
 public:
 	static constexpr GSSwizzleInfo swizzle32   {swizzleTables32,  0x00};
 	static constexpr GSSwizzleInfo swizzle32Z  {swizzleTables32,  0x18};
@@ -516,6 +519,16 @@ public:
 	__forceinline u16* vm16() const { return reinterpret_cast<u16*>(m_vm8); }
 	__forceinline u32* vm32() const { return reinterpret_cast<u32*>(m_vm8); }
 
+	__forceinline bool IsPageDirty(u32 page) const { return (m_dirty_pages[page / 32] & (1u << (page % 32))) != 0; }
+	__forceinline void MarkPageDirty(u32 page) { m_dirty_pages[page / 32] |= 1u << (page % 32); }
+	void MarkPagesDirty(const GSOffset::PageLooper& pages)
+	{
+		pages.loopPages([this](u32 page) { MarkPageDirty(page); });
+	}
+	void MarkPagesDirty(const GSOffset& off, const GSVector4i& r) { MarkPagesDirty(off.pageLooperForRect(r)); }
+	void MarkAllPagesDirty() { m_dirty_pages.fill(~0u); }
+	void ClearDirtyPages() { m_dirty_pages.fill(0); }
+
 	GSOffset GetOffset(u32 bp, u32 bw, u32 psm) const
 	{
 		return GSOffset(m_psm[psm].info, bp, bw, psm);
@@ -973,16 +986,19 @@ public:
 
 	void WritePixel32(u8* RESTRICT src, u32 pitch, const GSOffset& off, const GSVector4i& r)
 	{
+		MarkPagesDirty(off, r);
 		off.loopPixels(r, vm32(), (u32*)src, pitch, [&](u32* dst, u32* src) { *dst = *src; });
 	}
 
 	void WritePixel32(u8* RESTRICT src, u32 pitch, const GSOffset& off, const GSVector4i& r, u32 write_mask)
 	{
+		MarkPagesDirty(off, r);
 		off.loopPixels(r, vm32(), (u32*)src, pitch, [&](u32* dst, u32* src) { *dst = (*dst & ~write_mask) | (*src & write_mask); });
 	}
 
 	void WritePixel24(u8* RESTRICT src, u32 pitch, const GSOffset& off, const GSVector4i& r)
 	{
+		MarkPagesDirty(off, r);
 		off.loopPixels(r, vm32(), (u32*)src, pitch,
 			[&](u32* dst, u32* src)
 		{
@@ -992,11 +1008,13 @@ public:
 
 	void WritePixel16(u8* RESTRICT src, u32 pitch, const GSOffset& off, const GSVector4i& r)
 	{
+		MarkPagesDirty(off, r);
 		off.loopPixels(r, vm16(), (u16*)src, pitch, [&](u16* dst, u16* src) { *dst = *src; });
 	}
 
 	void WriteFrame16(u8* RESTRICT src, u32 pitch, const GSOffset& off, const GSVector4i& r)
 	{
+		MarkPagesDirty(off, r);
 		off.loopPixels(r, vm16(), (u32*)src, pitch,
 		[&](u16* dst, u32* src)
 		{
@@ -22,6 +22,7 @@
 u64 GSState::s_n = 0;
 u64 GSState::s_last_transfer_draw_n = 0;
 u64 GSState::s_transfer_n = 0;
+u64 GSState::s_last_vm_snapshot_id = 0;
 
 static __fi bool IsAutoFlushEnabled()
 {
@@ -2409,6 +2410,7 @@ void GSState::FlushWrite()
 	}
 
 	InvalidateVideoMem(m_env.BITBLTBUF, r);
+	m_mem.MarkPagesDirty(m_mem.GetOffset(m_env.BITBLTBUF.DBP, m_env.BITBLTBUF.DBW, m_env.BITBLTBUF.DPSM), r);
 
 	const GSLocalMemory::writeImage wi = GSLocalMemory::m_psm[m_env.BITBLTBUF.DPSM].wi;
 
@@ -2928,6 +2930,7 @@ void GSState::Write(const u8* mem, int len)
 		{
 			// received all data in one piece, no need to buffer it
 			InvalidateVideoMem(blit, r);
+			m_mem.MarkPagesDirty(m_mem.GetOffset(blit.DBP, blit.DBW, blit.DPSM), r);
 
 			psm.wi(m_mem, m_tr.x, m_tr.y, mem, m_tr.total, blit, m_tr.m_pos, m_tr.m_reg);
 
@@ -3056,6 +3059,8 @@ void GSState::Move()
 
 	InvalidateLocalMem(m_env.BITBLTBUF, GSVector4i(sx, sy, sx + w, sy + h));
 	InvalidateVideoMem(m_env.BITBLTBUF, GSVector4i(dx, dy, dx + w, dy + h));
+	m_mem.MarkPagesDirty(m_mem.GetOffset(m_env.BITBLTBUF.DBP, m_env.BITBLTBUF.DBW, m_env.BITBLTBUF.DPSM),
+		GSVector4i(dx, dy, dx + w, dy + h));
 	const bool overlaps = m_env.BITBLTBUF.SBP == m_env.BITBLTBUF.DBP;
 	const bool intersect = overlaps && !(GSVector4i(sx, sy, sx + w, sy + h).rintersect(GSVector4i(dx, dy, dx + w, dy + h)).rempty());
 
@@ -3529,16 +3534,26 @@ static void ReadState(T* dst, u8*& src, size_t len = sizeof(T))
 	src += len;
 }
 
-int GSState::Freeze(freezeData* fd, bool sizeonly)
+static void CopyDirtyPages(const GSLocalMemory& mem, u8* dst, const u8* src)
+{
+	for (u32 page = 0; page < GS_MAX_PAGES; page++)
+	{
+		if (mem.IsPageDirty(page))
+			std::memcpy(dst + page * GS_PAGE_SIZE, src + page * GS_PAGE_SIZE, GS_PAGE_SIZE);
+	}
+}
+
+int GSState::Freeze(freezeData* fd, bool sizeonly, u64* snapshot_id)
 {
 	const u32 version = STATE_VERSION;
+	const int size = GetSaveStateSize(version);
 	if (sizeonly)
 	{
-		fd->size = GetSaveStateSize(version);
+		fd->size = size;
 		return 0;
 	}
 
-	if (!fd->data || fd->size < GetSaveStateSize(version))
+	if (!fd->data || fd->size < size)
 		return -1;
 
 	Flush(GSFlushReason::SAVESTATE);
@@ -3601,7 +3616,15 @@ int GSState::Freeze(freezeData* fd, bool sizeonly)
 	WriteState(data, &m_tr.end);
 	WriteState(data, &m_tr.write);
 	// End of version 9 changes.
-	WriteState(data, m_mem.m_vm8, m_mem.m_vmsize);
+	if (snapshot_id && m_vm_snapshot_id != 0 && *snapshot_id == m_vm_snapshot_id)
+	{
+		CopyDirtyPages(m_mem, data, m_mem.m_vm8);
+		data += m_mem.m_vmsize;
+	}
+	else
+	{
+		WriteState(data, m_mem.m_vm8, m_mem.m_vmsize);
+	}
 
 	for (GIFPath& path : m_path)
 	{
@@ -3620,10 +3643,18 @@ int GSState::Freeze(freezeData* fd, bool sizeonly)
 
 	WriteState(data, &m_q);
 
+	if (snapshot_id)
+	{
+		// New id every time, so an older copy of the buffer can't be mistaken for this one.
+		m_vm_snapshot_id = ++s_last_vm_snapshot_id;
+		*snapshot_id = m_vm_snapshot_id;
+		m_mem.ClearDirtyPages();
+	}
+
 	return 0;
 }
 
-int GSState::Defrost(const freezeData* fd)
+int GSState::Defrost(const freezeData* fd, u64 snapshot_id)
 {
 	if (!fd || !fd->data || fd->size == 0)
 		return -1;
@@ -3730,7 +3761,22 @@ int GSState::Defrost(const freezeData* fd)
 		m_tr.write = true;
 	}
 
-	ReadState(m_mem.m_vm8, data, m_mem.m_vmsize);
+	if (snapshot_id != 0 && snapshot_id == m_vm_snapshot_id)
+	{
+		// Only the pages written since the snapshot was taken can differ from it.
+		CopyDirtyPages(m_mem, m_mem.m_vm8, data);
+		data += m_mem.m_vmsize;
+	}
+	else
+	{
+		ReadState(m_mem.m_vm8, data, m_mem.m_vmsize);
+	}
+
+	m_vm_snapshot_id = snapshot_id;
+	if (snapshot_id != 0)
+		m_mem.ClearDirtyPages();
+	else
+		m_mem.MarkAllPagesDirty();
 
 	for (GIFPath& path : m_path)
 	{
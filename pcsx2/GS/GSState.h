@@ -316,6 +316,10 @@ public:
 	static u64 s_n;
 	static u64 s_last_transfer_draw_n;
 	static u64 s_transfer_n;
+	static u64 s_last_vm_snapshot_id;
+
+	// Incremental snapshot which local memory's dirty pages are relative to, zero if there isn't one.
+	u64 m_vm_snapshot_id = 0;
 
 	GSPerfMon m_perfmon_frame; // Track stat across a frame.
 	GSPerfMon m_perfmon_draw;  // Track stat across a draw.
@@ -517,8 +521,11 @@ public:
 	void ReadFIFO(u8* mem, int size);
 	void ReadLocalMemoryUnsync(u8* mem, int qwc, GIFRegBITBLTBUF BITBLTBUF, GIFRegTRXPOS TRXPOS, GIFRegTRXREG TRXREG);
 	template<int index> void Transfer(const u8* mem, u32 size);
-	int Freeze(freezeData* fd, bool sizeonly);
-	int Defrost(const freezeData* fd);
+	/// Incremental freezes are for buffers which are reused between snapshots. The caller keeps the id of the snapshot
+	/// its buffer holds, or zero if it doesn't know, and Freeze() hands back the new one. If it's the last snapshot
+	/// taken, only the pages of local memory written since are copied, in either direction.
+	int Freeze(freezeData* fd, bool sizeonly, u64* snapshot_id = nullptr);
+	int Defrost(const freezeData* fd, u64 snapshot_id = 0);
 
 	u8* GetRegsMem() const { return reinterpret_cast<u8*>(m_regs); }
 	void SetRegsMem(u8* basemem) { m_regs = reinterpret_cast<GSPrivRegSet*>(basemem); }
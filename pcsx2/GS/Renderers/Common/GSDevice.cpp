@@ -6,6 +6,7 @@
 #include "GS/GS.h"
 #include "GS/GSUtil.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 
 #include "common/Console.h"
 #include "common/BitUtils.h"
@@ -727,6 +728,8 @@ void GSDevice::AgePool()
 
 void GSDevice::PurgePool()
 {
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::TextureCachePurge);
+
 	for (FastList<GSTexture*>& pool : m_pool)
 	{
 		for (GSTexture* t : pool)
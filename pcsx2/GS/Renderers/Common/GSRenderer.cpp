@@ -12,6 +12,7 @@
 #include "GSDumpReplayer.h"
 #include "Host.h"
 #include "PerformanceMetrics.h"
+#include "Tracing.h"
 #include "pcsx2/Config.h"
 #include "VMManager.h"
 
@@ -26,12 +27,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <deque>
 #include <thread>
 #include <mutex>
 
 static void DumpGSPrivRegs(const GSPrivRegSet& r, const std::string& filename);
 
+static std::atomic_bool s_snapshot_pending{false};
+
 static constexpr std::array<PresentShader, 8> s_tv_shader_indices = {
 	PresentShader::COPY, PresentShader::SCANLINE,
 	PresentShader::DIAGONAL_FILTER, PresentShader::TRIANGULAR_FILTER,
@@ -73,6 +77,7 @@ void GSRenderer::Reset(bool hardware_reset)
 void GSRenderer::Destroy()
 {
 	GSCapture::EndCapture();
+	s_snapshot_pending.store(false, std::memory_order_release);
 }
 
 void GSRenderer::UpdateRenderFixes()
@@ -577,8 +582,10 @@ void GSRenderer::EndPresentFrame()
 	ImGuiManager::NewFrame();
 }
 
-void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
+void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame, bool hidden, bool run_ahead)
 {
+	TRACE_ZONE("GS VSync");
+
 	if (GSConfig.ShouldDump(s_n, g_perfmon.GetFrame()))
 	{
 		if (GSConfig.SaveInfo)
@@ -603,7 +610,7 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 	const bool fb_sprite_frame = (fb_sprite_blits > 0);
 
 	bool skip_frame = false;
-	if (GSConfig.SkipDuplicateFrames && !GSCapture::IsCapturingVideo())
+	if (GSConfig.SkipDuplicateFrames && !hidden && !GSCapture::IsCapturingVideo())
 	{
 		bool is_unique_frame;
 		switch (PerformanceMetrics::GetInternalFPSMethod())
@@ -635,15 +642,16 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 	m_last_draw_n = s_n;
 	m_last_transfer_n = s_transfer_n;
 
-	// Skip presentation when running uncapped while vsync is on.
-	if (skip_frame || g_gs_device->ShouldSkipPresentingFrame())
+	// Skip presentation when running uncapped while vsync is on. Frames which run-ahead keeps off screen
+	// aren't presented at all, and stay out of the metrics.
+	if (!hidden && (skip_frame || g_gs_device->ShouldSkipPresentingFrame()))
 	{
 		if (BeginPresentFrame(true))
 			EndPresentFrame();
 
 		PerformanceMetrics::Update(registers_written, fb_sprite_frame, skip_frame);
 	}
-	else
+	else if (!hidden)
 	{
 		if (!idle_frame)
 			g_gs_device->AgePool();
@@ -687,8 +695,12 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 			}
 		}
 
+		// Time spent blocked on the swap chain, for latency-reduced pacing.
+		Common::Timer present_wait_timer;
 		if (BeginPresentFrame(false))
 		{
+			double present_wait_ms = present_wait_timer.GetTimeMilliseconds();
+
 			if (current && !blank_frame)
 			{
 				const u64 current_time = Common::Timer::GetCurrentValue();
@@ -698,7 +710,10 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 					s_tv_shader_indices[GSConfig.TVShader], shader_time, GSConfig.LinearPresent != GSPostBilinearMode::Off);
 			}
 
+			present_wait_timer.Reset();
 			EndPresentFrame();
+			present_wait_ms += present_wait_timer.GetTimeMilliseconds();
+			PerformanceMetrics::OnPresentWait(static_cast<float>(present_wait_ms));
 
 			if (GSConfig.OsdShowGPU || GSDumpReplayer::IsReplayingDump())
 				PerformanceMetrics::OnGPUPresent(g_gs_device->GetAndResetAccumulatedGPUTime());
@@ -708,7 +723,9 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 	}
 
 	// snapshot
-	if (!m_snapshot.empty())
+	// Frames emulated by run-ahead get rolled back, so they're kept out of dumps. It's disabled while a
+	// snapshot is pending, which leaves only the frames it had already queued to wait out.
+	if (!run_ahead && !m_snapshot.empty())
 	{
 		u32 screenshot_width, screenshot_height;
 		std::vector<u32> screenshot_pixels;
@@ -790,7 +807,7 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 
 		m_snapshot = {};
 	}
-	else if (m_dump)
+	else if (!run_ahead && m_dump)
 	{
 		const bool last = (m_dump_frames == 0);
 		if (m_dump->VSync(field, last, m_regs))
@@ -806,6 +823,8 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 		}
 	}
 
+	s_snapshot_pending.store(!m_snapshot.empty() || m_dump, std::memory_order_release);
+
 	// capture
 	if (GSCapture::IsCapturingVideo())
 	{
@@ -858,6 +877,7 @@ void GSRenderer::QueueSnapshot(const std::string& path, const u32 gsdump_frames)
 
 	// this is really gross, but wx we get the snapshot request after shift...
 	m_dump_frames = gsdump_frames;
+	s_snapshot_pending.store(true, std::memory_order_release);
 }
 
 static std::string GSGetBaseFilename()
@@ -952,6 +972,12 @@ void GSRenderer::StopGSDump()
 {
 	m_snapshot = {};
 	m_dump_frames = 0;
+	s_snapshot_pending.store(static_cast<bool>(m_dump), std::memory_order_release);
+}
+
+bool GSRenderer::IsSnapshotPending()
+{
+	return s_snapshot_pending.load(std::memory_order_acquire);
 }
 
 void GSRenderer::PresentCurrentFrame()
@@ -40,7 +40,7 @@ public:
 
 	virtual void UpdateRenderFixes();
 
-	virtual void VSync(u32 field, bool registers_written, bool idle_frame);
+	virtual void VSync(u32 field, bool registers_written, bool idle_frame, bool hidden, bool run_ahead);
 	virtual bool CanUpscale() { return false; }
 	virtual float GetUpscaleMultiplier() { return 1.0f; }
 	virtual float GetTextureScaleFactor() { return 1.0f; }
@@ -56,6 +56,9 @@ public:
 
 	void QueueSnapshot(const std::string& path, const u32 gsdump_frames);
 	void StopGSDump();
+
+	/// Returns true while a screenshot or GS dump is queued or being written. Safe to call from any thread.
+	static bool IsSnapshotPending();
 	void PresentCurrentFrame();
 	bool BeginCapture(std::string filename, const GSVector2i& size = GSVector2i(0, 0));
 	void EndCapture();
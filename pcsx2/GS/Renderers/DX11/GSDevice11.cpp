@@ -9,6 +9,7 @@
 #include "GS/GSPerfMon.h"
 #include "GS/GSUtil.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 
 #include "common/BitUtils.h"
 #include "common/Error.h"
@@ -1827,6 +1828,8 @@ void GSDevice11::SetupPS(const PSSelector& sel, const GSHWDrawConfig::PSConstant
 
 	if (i == m_ps.end())
 	{
+		PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::ShaderCompile);
+
 		ShaderMacro sm;
 
 		sm.AddMacro("PIXEL_SHADER", 1);
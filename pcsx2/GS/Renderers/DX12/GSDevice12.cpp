@@ -10,6 +10,7 @@
 #include "GS/Renderers/DX12/D3D12Builders.h"
 #include "GS/Renderers/DX12/D3D12ShaderCache.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 #include "ShaderCacheVersion.h"
 
 #include "common/Console.h"
@@ -3220,6 +3221,8 @@ const ID3DBlob* GSDevice12::GetTFXPixelShader(const GSHWDrawConfig::PSSelector&
 
 GSDevice12::ComPtr<ID3D12PipelineState> GSDevice12::CreateTFXPipeline(const PipelineSelector& p)
 {
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::ShaderCompile);
+
 	static constexpr std::array<D3D12_PRIMITIVE_TOPOLOGY_TYPE, 3> topology_lookup = {{
 		D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT, // Point
 		D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE, // Line
@@ -95,7 +95,7 @@ void GSRendererHW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
 	SetTCOffset();
 }
 
-void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
+void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame, bool hidden, bool run_ahead)
 {
 	if (GSConfig.LoadTextureReplacements)
 		GSTextureReplacements::ProcessAsyncLoadedTextures();
@@ -143,7 +143,7 @@ void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
 	m_skip = 0;
 	m_skip_offset = 0;
 
-	GSRenderer::VSync(field, registers_written, idle_frame);
+	GSRenderer::VSync(field, registers_written, idle_frame, hidden, run_ahead);
 }
 
 GSTexture* GSRendererHW::GetOutput(int i, float& scale, int& y_offset)
@@ -2566,6 +2566,7 @@ void GSRendererHW::SwSpriteRender()
 		}
 	}
 
+	m_mem.MarkPagesDirty(dpo, m_r);
 	g_texture_cache->InvalidateVideoMem(dpo, m_r);
 }
 
@@ -9903,6 +9904,8 @@ void GSRendererHW::ClearGSLocalMemory(const GSOffset& off, const GSVector4i& r,
 	GL_INS("HW: ClearGSLocalMemory(): %08X %d,%d => %d,%d @ BP %x BW %u %s", vert_color, r.x, r.y, r.z, r.w, off.bp(),
 		off.bw(), GSUtil::GetPSMName(off.psm()));
 
+	m_mem.MarkPagesDirty(off, r);
+
 	const u32 psm = (off.psm() == PSMCT32 && m_cached_ctx.FRAME.FBMSK == 0xFF000000u) ? PSMCT24 : off.psm();
 	const int format = GSLocalMemory::m_psm[psm].fmt;
 
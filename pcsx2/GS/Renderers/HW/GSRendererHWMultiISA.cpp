@@ -544,6 +544,11 @@ bool GSRendererHWFunctions::SwPrimRender(GSRendererHW& hw, bool invalidate_tc, b
 
 	static_cast<GSSingleRasterizer*>(hw.m_sw_rasterizer.get())->Draw(data);
 
+	if (gd.sel.fwrite)
+		hw.m_mem.MarkPagesDirty(context->offset.fb, bbox);
+	if (gd.sel.zwrite)
+		hw.m_mem.MarkPagesDirty(context->offset.zb, bbox);
+
 	if (invalidate_tc)
 		g_texture_cache->InvalidateVideoMem(context->offset.fb, bbox);
 
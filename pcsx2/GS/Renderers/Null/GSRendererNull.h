@@ -11,7 +11,7 @@ public:
 	GSRendererNull();
 
 protected:
-	void VSync(u32 field, bool registers_written, bool idle_frame) override;
+	void VSync(u32 field, bool registers_written, bool idle_frame, bool hidden, bool run_ahead) override;
 	void Draw() override;
 	GSTexture* GetOutput(int i, float& scale, int& y_offset) override;
 };
@@ -9,6 +9,7 @@
 #include "GS/GSPerfMon.h"
 #include "GS/GSUtil.h"
 #include "Host.h"
+#include "PerformanceMetrics.h"
 
 #include "common/Console.h"
 #include "common/Error.h"
@@ -2633,6 +2634,8 @@ void GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
 		return;
 	}
 
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::ShaderCompile);
+
 	const std::string vs(GetVSSource(psel.vs));
 	const std::string ps(GetPSSource(psel.ps));
 
@@ -7,6 +7,7 @@
 #include "GS/Renderers/SW/GSDrawScanline.h"
 #include "GS/GSExtra.h"
 #include "PerformanceMetrics.h"
+#include "Tracing.h"
 #include "VMManager.h"
 
 #include "common/AlignedMalloc.h"
@@ -128,6 +129,8 @@ void GSRasterizer::Draw(GSRasterizerData& data)
 	if ((data.vertex && data.vertex_count == 0) || (data.index && data.index_count == 0))
 		return;
 
+	TRACE_ZONE("SW Rasterize");
+
 	m_pixels.actual = 0;
 	m_pixels.total = 0;
 	m_primcount = 0;
@@ -1523,7 +1526,9 @@ GSRasterizerList::~GSRasterizerList()
 
 void GSRasterizerList::OnWorkerStartup(int i, u64 affinity)
 {
-	Threading::SetNameOfCurrentThread(StringUtil::StdStringFromFormat("GS-SW-%d", i).c_str());
+	const std::string name = StringUtil::StdStringFromFormat("GS-SW-%d", i);
+	Threading::SetNameOfCurrentThread(name.c_str());
+	Tracing::SetThreadName(name.c_str());
 
 	Threading::ThreadHandle handle(Threading::ThreadHandle::GetForCallingThread());
 	if (affinity != 0)
@@ -68,7 +68,7 @@ void GSRendererSW::Destroy()
 	m_output = nullptr;
 }
 
-void GSRendererSW::VSync(u32 field, bool registers_written, bool idle_frame)
+void GSRendererSW::VSync(u32 field, bool registers_written, bool idle_frame, bool hidden, bool run_ahead)
 {
 	Sync(0); // IncAge might delete a cached texture in use
 
@@ -89,7 +89,7 @@ void GSRendererSW::VSync(u32 field, bool registers_written, bool idle_frame)
 	//
 	*/
 
-	GSRenderer::VSync(field, registers_written, idle_frame);
+	GSRenderer::VSync(field, registers_written, idle_frame, hidden, run_ahead);
 
 	m_tc->IncAge();
 
@@ -794,10 +794,12 @@ void GSRendererSW::UsePages(const GSOffset::PageLooper& pages, const int type)
 			case 0:
 				pxAssert((m_fzb_pages[page] & 0xFFFF) < USHRT_MAX);
 				m_fzb_pages[page] += 1;
+				m_mem.MarkPageDirty(page);
 				break;
 			case 1:
 				pxAssert((m_fzb_pages[page] >> 16) < USHRT_MAX);
 				m_fzb_pages[page] += 0x10000;
+				m_mem.MarkPageDirty(page);
 				break;
 			case 2:
 				pxAssert(m_tex_pages[page] < USHRT_MAX);
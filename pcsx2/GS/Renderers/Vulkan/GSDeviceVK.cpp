@@ -14,6 +14,7 @@
 #include "BuildVersion.h"
 #include "Host.h"
 #include "ImGui/ImGuiManager.h"
+#include "PerformanceMetrics.h"
 
 #include "common/Console.h"
 #include "common/BitUtils.h"
@@ -4929,6 +4930,8 @@ VkShaderModule GSDeviceVK::GetTFXFragmentShader(const GSHWDrawConfig::PSSelector
 
 VkPipeline GSDeviceVK::CreateTFXPipeline(const PipelineSelector& p)
 {
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::ShaderCompile);
+
 	static constexpr std::array<VkPrimitiveTopology, 3> topology_lookup = {{
 		VK_PRIMITIVE_TOPOLOGY_POINT_LIST, // Point
 		VK_PRIMITIVE_TOPOLOGY_LINE_LIST, // Line
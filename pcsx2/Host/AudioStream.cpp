@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Host/AudioStream.h"
+#include "Host/AudioStretcher.h"
 #include "FreeSurroundDecoder.h"
 #include "Host.h"
 #include "GS/GSVector.h"
@@ -15,13 +16,12 @@
 #include "common/SmallString.h"
 #include "common/Timer.h"
 
-#include "SoundTouch.h"
-
 #include <algorithm>
 #include <bit>
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <utility>
 
 //#define LOG_UNDERRUN(...) DEV_LOG(__VA_ARGS__)
 #define LOG_UNDERRUN(...) (void)0
@@ -220,6 +220,38 @@ std::optional<AudioExpansionMode> AudioStream::ParseExpansionMode(const char* na
 	return std::nullopt;
 }
 
+static constexpr const std::array s_stretch_mode_names = {
+	"SoundTouch",
+	"WSOLA",
+};
+static constexpr const std::array s_stretch_mode_display_names = {
+	TRANSLATE_NOOP("AudioStream", "SoundTouch"),
+	TRANSLATE_NOOP("AudioStream", "Lightweight (WSOLA)"),
+};
+
+const char* AudioStream::GetStretchModeName(AudioStretchMode mode)
+{
+	return (static_cast<u32>(mode) < s_stretch_mode_names.size()) ? s_stretch_mode_names[static_cast<u32>(mode)] : "";
+}
+
+const char* AudioStream::GetStretchModeDisplayName(AudioStretchMode mode)
+{
+	return (static_cast<u32>(mode) < s_stretch_mode_display_names.size()) ?
+			   Host::TranslateToCString("AudioStream", s_stretch_mode_display_names[static_cast<u32>(mode)]) :
+			   "";
+}
+
+std::optional<AudioStretchMode> AudioStream::ParseStretchMode(const char* name)
+{
+	for (u8 i = 0; i < static_cast<u8>(AudioStretchMode::Count); i++)
+	{
+		if (std::strcmp(name, s_stretch_mode_names[i]) == 0)
+			return static_cast<AudioStretchMode>(i);
+	}
+
+	return std::nullopt;
+}
+
 u32 AudioStream::GetBufferedFramesRelaxed() const
 {
 	const u32 rpos = m_rpos.load(std::memory_order_relaxed);
@@ -227,8 +259,33 @@ u32 AudioStream::GetBufferedFramesRelaxed() const
 	return (wpos + m_buffer_size - rpos) % m_buffer_size;
 }
 
+float AudioStream::GetLatencyMS() const
+{
+	return static_cast<float>((GetBufferedFramesRelaxed() + GetCallbackFrames()) * 1000u) / static_cast<float>(m_sample_rate);
+}
+
+void AudioStream::UpdateCallbackTiming(u32 num_frames)
+{
+	static constexpr float JITTER_DECAY = 0.998f;
+
+	const u64 now = Common::Timer::GetCurrentValue();
+	const u64 last = std::exchange(m_last_callback_time, now);
+	m_callback_frames.store(num_frames, std::memory_order_relaxed);
+
+	// How late or early the backend was compared to pulling one period per period.
+	// A gap of several periods is a pause or device change, not jitter.
+	const float period = static_cast<float>(num_frames);
+	const float elapsed = static_cast<float>(Common::Timer::ConvertValueToSeconds(now - last) * m_sample_rate);
+	if (last != 0 && elapsed < period * 4.0f)
+		m_callback_jitter = std::max(std::abs(elapsed - period), m_callback_jitter * JITTER_DECAY);
+
+	m_callback_jitter_frames.store(static_cast<u32>(m_callback_jitter), std::memory_order_relaxed);
+}
+
 void AudioStream::ReadFrames(SampleType* samples, u32 num_frames)
 {
+	UpdateCallbackTiming(num_frames);
+
 	const u32 available_frames = GetBufferedFramesRelaxed();
 	u32 frames_to_read = num_frames;
 	u32 silence_frames = 0;
@@ -255,6 +312,7 @@ void AudioStream::ReadFrames(SampleType* samples, u32 num_frames)
 		silence_frames = frames_to_read - available_frames;
 		frames_to_read = available_frames;
 		m_filling = true;
+		m_underrun_count.fetch_add(1, std::memory_order_relaxed);
 
 		if (IsStretchEnabled())
 			StretchUnderrun();
@@ -344,6 +402,7 @@ void AudioStream::InternalWriteFrames(const SampleType* data, u32 num_frames)
 	const u32 free = m_buffer_size - GetBufferedFramesRelaxed();
 	if (free <= num_frames)
 	{
+		m_overrun_count.fetch_add(1, std::memory_order_relaxed);
 		if (IsStretchEnabled())
 		{
 			StretchOverrun();
@@ -398,6 +457,9 @@ void AudioStream::AllocateBuffer()
 	const u32 multiplier = IsStretchEnabled() ? 16 : 1;
 	m_buffer_size = GetAlignedBufferSize(((m_parameters.buffer_ms * multiplier) * m_sample_rate) / 1000);
 	m_target_buffer_size = GetAlignedBufferSize((m_sample_rate * m_parameters.buffer_ms) / 1000u);
+	m_max_target_buffer_size = m_target_buffer_size;
+	m_adaptive_target = static_cast<float>(m_target_buffer_size);
+	m_adaptive_last_underruns = GetUnderrunCount();
 
 	m_buffer = std::make_unique<float[]>(m_buffer_size * m_internal_channels);
 	m_staging_buffer = std::make_unique<float[]>(CHUNK_SIZE * m_internal_channels);
@@ -432,9 +494,9 @@ void AudioStream::EmptyBuffer()
 
 	if (IsStretchEnabled())
 	{
-		m_soundtouch->clear();
+		m_stretcher->Clear();
 		if (IsStretchEnabled())
-			m_soundtouch->setTempo(m_nominal_rate);
+			m_stretcher->SetTempo(m_nominal_rate);
 	}
 
 	m_wpos.store(m_rpos.load(std::memory_order_acquire), std::memory_order_release);
@@ -457,7 +519,7 @@ void AudioStream::UpdateTargetTempo(float tempo)
 	m_average_position = AVERAGING_WINDOW;
 	m_average_available = AVERAGING_WINDOW;
 	std::fill_n(m_average_fullness.data(), AVERAGING_WINDOW, tempo);
-	m_soundtouch->setTempo(tempo);
+	m_stretcher->SetTempo(tempo);
 	m_stretch_reset = 0;
 	m_stretch_inactive = false;
 	m_stretch_ok_count = 0;
@@ -597,18 +659,8 @@ void AudioStream::StretchAllocate()
 	if (!IsStretchEnabled())
 		return;
 
-	m_soundtouch = std::make_unique<soundtouch::SoundTouch>();
-	m_soundtouch->setSampleRate(m_sample_rate);
-	m_soundtouch->setChannels(m_internal_channels);
-
-	m_soundtouch->setSetting(SETTING_USE_QUICKSEEK, m_parameters.stretch_use_quickseek);
-	m_soundtouch->setSetting(SETTING_USE_AA_FILTER, m_parameters.stretch_use_aa_filter);
-
-	m_soundtouch->setSetting(SETTING_SEQUENCE_MS, m_parameters.stretch_sequence_length_ms);
-	m_soundtouch->setSetting(SETTING_SEEKWINDOW_MS, m_parameters.stretch_seekwindow_ms);
-	m_soundtouch->setSetting(SETTING_OVERLAP_MS, m_parameters.stretch_overlap_ms);
-
-	m_soundtouch->setTempo(m_nominal_rate);
+	m_stretcher = AudioStretcher::Create(m_parameters.stretch_mode, m_sample_rate, m_internal_channels, m_parameters);
+	m_stretcher->SetTempo(m_nominal_rate);
 
 	m_stretch_reset = STRETCH_RESET_THRESHOLD;
 	m_stretch_inactive = false;
@@ -622,17 +674,17 @@ void AudioStream::StretchAllocate()
 
 void AudioStream::StretchDestroy()
 {
-	m_soundtouch.reset();
+	m_stretcher.reset();
 }
 
 void AudioStream::StretchWriteBlock(const float* block)
 {
 	if (IsStretchEnabled())
 	{
-		m_soundtouch->putSamples(block, CHUNK_SIZE);
+		m_stretcher->PutSamples(block, CHUNK_SIZE);
 
 		u32 tempProgress;
-		while (tempProgress = m_soundtouch->receiveSamples(m_staging_buffer.get(), CHUNK_SIZE), tempProgress != 0)
+		while (tempProgress = m_stretcher->ReceiveSamples(m_staging_buffer.get(), CHUNK_SIZE), tempProgress != 0)
 		{
 			InternalWriteFrames(m_staging_buffer.get(), tempProgress);
 		}
@@ -680,6 +732,12 @@ void AudioStream::UpdateStretchTempo()
 
 	float base_target_usage = static_cast<float>(m_target_buffer_size) * m_nominal_rate;
 
+	if (m_parameters.adaptive_buffer)
+	{
+		UpdateAdaptiveTarget();
+		base_target_usage = static_cast<float>(m_target_buffer_size) * m_nominal_rate;
+	}
+
 	// state vars
 	if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
 	{
@@ -754,12 +812,40 @@ void AudioStream::UpdateStretchTempo()
 		iterations++;
 	}
 
-	m_soundtouch->setTempo(tempo);
+	m_stretcher->SetTempo(tempo);
 
 	if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
 		m_stretch_reset = 0;
 }
 
+void AudioStream::UpdateAdaptiveTarget()
+{
+	// Called once per chunk, so this shrinks by roughly 0.8ms every second while the backend keeps up.
+	static constexpr float SHRINK_FRAMES_PER_CHUNK = 0.05f;
+
+	const u32 period = GetCallbackFrames();
+	if (period == 0)
+		return;
+
+	// The backend pulls a whole period at a time, so keep two of them buffered plus however late it has been.
+	const float min_target = static_cast<float>(period * 2 + m_callback_jitter_frames.load(std::memory_order_relaxed) + CHUNK_SIZE);
+	const float max_target = static_cast<float>(m_max_target_buffer_size);
+
+	const u32 underruns = GetUnderrunCount();
+	if (underruns != m_adaptive_last_underruns)
+	{
+		m_adaptive_last_underruns = underruns;
+		m_adaptive_target += static_cast<float>(period);
+	}
+	else
+	{
+		m_adaptive_target -= SHRINK_FRAMES_PER_CHUNK;
+	}
+
+	m_adaptive_target = std::min(std::max(m_adaptive_target, min_target), max_target);
+	m_target_buffer_size = static_cast<u32>(m_adaptive_target);
+}
+
 void AudioStream::StretchUnderrun()
 {
 	// Didn't produce enough frames in time.
@@ -788,6 +874,8 @@ void AudioStreamParameters::LoadSave(SettingsWrapper& wrap, const char* section)
 	stretch_overlap_ms = static_cast<u16>(std::clamp<int>(wrap.EntryBitfield(section, "StretchOverlapMS", DEFAULT_STRETCH_OVERLAP), 0, std::numeric_limits<u16>::max()));
 	stretch_use_quickseek = wrap.EntryBitBool(section, "StretchUseQuickSeek", DEFAULT_STRETCH_USE_QUICKSEEK);
 	stretch_use_aa_filter = wrap.EntryBitBool(section, "StretchUseAAFilter", DEFAULT_STRETCH_USE_AA_FILTER);
+	adaptive_buffer = wrap.EntryBitBool(section, "AdaptiveBuffer", DEFAULT_ADAPTIVE_BUFFER);
+	wrap.EnumEntry(section, "StretchMode", stretch_mode, &AudioStream::ParseStretchMode, &AudioStream::GetStretchModeName, DEFAULT_STRETCH_MODE);
 
 	expand_block_size = static_cast<u16>(std::clamp<int>(wrap.EntryBitfield(section, "ExpandBlockSize", DEFAULT_EXPAND_BLOCK_SIZE), 0, std::numeric_limits<u16>::max()));
 	wrap.Entry(section, "ExpandCircularWrap", expand_circular_wrap, DEFAULT_EXPAND_CIRCULAR_WRAP);
@@ -15,11 +15,8 @@
 
 class Error;
 
+class AudioStretcher;
 class FreeSurroundDecoder;
-namespace soundtouch
-{
-	class SoundTouch;
-}
 
 class AudioStream
 {
@@ -57,6 +54,10 @@ public:
 	static const char* GetExpansionModeDisplayName(AudioExpansionMode mode);
 	static std::optional<AudioExpansionMode> ParseExpansionMode(const char* name);
 
+	static const char* GetStretchModeName(AudioStretchMode mode);
+	static const char* GetStretchModeDisplayName(AudioStretchMode mode);
+	static std::optional<AudioStretchMode> ParseStretchMode(const char* name);
+
 	__fi u32 GetSampleRate() const { return m_sample_rate; }
 	__fi u32 GetInternalChannels() const { return m_internal_channels; }
 	__fi u32 GetOutputChannels() const { return m_internal_channels; }
@@ -71,6 +72,18 @@ public:
 
 	u32 GetBufferedFramesRelaxed() const;
 
+	/// Number of times the backend asked for more frames than were buffered, since the stream was created.
+	__fi u32 GetUnderrunCount() const { return m_underrun_count.load(std::memory_order_relaxed); }
+
+	/// Number of chunks dropped because the buffer was full, since the stream was created.
+	__fi u32 GetOverrunCount() const { return m_overrun_count.load(std::memory_order_relaxed); }
+
+	/// Frames requested by the most recent backend callback, zero until the backend starts pulling.
+	__fi u32 GetCallbackFrames() const { return m_callback_frames.load(std::memory_order_relaxed); }
+
+	/// Approximate time between a frame being written and it reaching the backend, in milliseconds.
+	float GetLatencyMS() const;
+
 	/// Temporarily pauses the stream, preventing it from requesting data.
 	virtual void SetPaused(bool paused);
 
@@ -160,6 +173,9 @@ private:
 	void StretchUnderrun();
 	void StretchOverrun();
 
+	void UpdateCallbackTiming(u32 num_frames);
+	void UpdateAdaptiveTarget();
+
 	float AddAndGetAverageTempo(float val);
 	void UpdateStretchTempo();
 
@@ -170,11 +186,24 @@ private:
 	std::atomic<u32> m_rpos{0};
 	std::atomic<u32> m_wpos{0};
 
-	std::unique_ptr<soundtouch::SoundTouch> m_soundtouch;
+	std::unique_ptr<AudioStretcher> m_stretcher;
 
 	u32 m_target_buffer_size = 0;
 	u32 m_stretch_reset = STRETCH_RESET_THRESHOLD;
 
+	// Backend callback cadence, written by the callback thread.
+	std::atomic<u32> m_callback_frames{0};
+	std::atomic<u32> m_callback_jitter_frames{0};
+	std::atomic<u32> m_underrun_count{0};
+	std::atomic<u32> m_overrun_count{0};
+	u64 m_last_callback_time = 0;
+	float m_callback_jitter = 0.0f;
+
+	// Adaptive buffer target, only used by the stretcher. Never exceeds the configured buffer size.
+	u32 m_max_target_buffer_size = 0;
+	u32 m_adaptive_last_underruns = 0;
+	float m_adaptive_target = 0.0f;
+
 	u32 m_stretch_ok_count = 0;
 	float m_nominal_rate = 1.0f;
 	float m_dynamic_target_usage = 0.0f;
@@ -26,6 +26,13 @@ enum class AudioExpansionMode : u8
 	Count
 };
 
+enum class AudioStretchMode : u8
+{
+	SoundTouch,
+	WSOLA,
+	Count
+};
+
 struct AudioStreamParameters
 {
 	AudioExpansionMode expansion_mode = DEFAULT_EXPANSION_MODE;
@@ -38,6 +45,8 @@ struct AudioStreamParameters
 	u16 stretch_overlap_ms = DEFAULT_STRETCH_OVERLAP;
 	bool stretch_use_quickseek = DEFAULT_STRETCH_USE_QUICKSEEK;
 	bool stretch_use_aa_filter = DEFAULT_STRETCH_USE_AA_FILTER;
+	bool adaptive_buffer = DEFAULT_ADAPTIVE_BUFFER;
+	AudioStretchMode stretch_mode = DEFAULT_STRETCH_MODE;
 
 	float expand_circular_wrap = DEFAULT_EXPAND_CIRCULAR_WRAP;
 	float expand_shift = DEFAULT_EXPAND_SHIFT;
@@ -54,6 +63,7 @@ struct AudioStreamParameters
 	static constexpr u16 DEFAULT_BUFFER_MS = 50;
 	static constexpr u16 DEFAULT_OUTPUT_LATENCY_MS = 20;
 	static constexpr bool DEFAULT_OUTPUT_LATENCY_MINIMAL = false;
+	static constexpr bool DEFAULT_ADAPTIVE_BUFFER = false;
 
 	static constexpr u16 DEFAULT_EXPAND_BLOCK_SIZE = 2048;
 	static constexpr float DEFAULT_EXPAND_CIRCULAR_WRAP = 90.0f;
@@ -72,6 +82,7 @@ struct AudioStreamParameters
 
 	static constexpr bool DEFAULT_STRETCH_USE_QUICKSEEK = false;
 	static constexpr bool DEFAULT_STRETCH_USE_AA_FILTER = false;
+	static constexpr AudioStretchMode DEFAULT_STRETCH_MODE = AudioStretchMode::SoundTouch;
 
 	void LoadSave(SettingsWrapper& wrap, const char* section);
 
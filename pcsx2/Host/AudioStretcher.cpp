@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Host/AudioStretcher.h"
+#include "GS/GSVector.h"
+
+#include "SoundTouch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+AudioStretcher::AudioStretcher() = default;
+
+AudioStretcher::~AudioStretcher() = default;
+
+namespace
+{
+	class SoundTouchStretcher final : public AudioStretcher
+	{
+	public:
+		SoundTouchStretcher(u32 sample_rate, u32 channels, const AudioStreamParameters& parameters);
+		~SoundTouchStretcher() override;
+
+		void SetTempo(float tempo) override;
+		void PutSamples(const float* samples, u32 num_frames) override;
+		u32 ReceiveSamples(float* samples, u32 max_frames) override;
+		void Clear() override;
+
+	private:
+		soundtouch::SoundTouch m_soundtouch;
+	};
+
+	/// Waveform-similarity overlap-add. Cuts the input into fixed length sequences, and crossfades each one into the
+	/// last at whichever offset in the seek window lines the waveforms up best. Uses the same sequence, seek window
+	/// and overlap settings as SoundTouch, but skips its anti-alias filter and rate transposer.
+	class WSOLAStretcher final : public AudioStretcher
+	{
+	public:
+		WSOLAStretcher(u32 sample_rate, u32 channels, const AudioStreamParameters& parameters);
+		~WSOLAStretcher() override;
+
+		void SetTempo(float tempo) override;
+		void PutSamples(const float* samples, u32 num_frames) override;
+		u32 ReceiveSamples(float* samples, u32 max_frames) override;
+		void Clear() override;
+
+	private:
+		u32 GetInputFrames() const { return static_cast<u32>(m_input.size() / m_channels) - m_input_pos; }
+
+		void Process();
+		u32 FindBestOffset();
+		void SetOverlap(const float* samples);
+
+		u32 m_channels;
+		u32 m_sequence;
+		u32 m_overlap;
+		u32 m_seek;
+		bool m_quick_seek;
+		bool m_have_overlap = false;
+
+		float m_tempo = 1.0f;
+		double m_skip_fraction = 0.0;
+
+		std::vector<float> m_input;
+		u32 m_input_pos = 0;
+		std::vector<float> m_output;
+		u32 m_output_pos = 0;
+
+		// Tail of the previous sequence, and its mono mixdown for the correlation, at full and half rate.
+		std::vector<float> m_overlap_buffer;
+		std::vector<float> m_overlap_mono;
+		std::vector<float> m_overlap_mono_half;
+		std::vector<float> m_window_mono;
+		std::vector<float> m_window_mono_half;
+	};
+} // namespace
+
+SoundTouchStretcher::SoundTouchStretcher(u32 sample_rate, u32 channels, const AudioStreamParameters& parameters)
+{
+	m_soundtouch.setSampleRate(sample_rate);
+	m_soundtouch.setChannels(channels);
+
+	m_soundtouch.setSetting(SETTING_USE_QUICKSEEK, parameters.stretch_use_quickseek);
+	m_soundtouch.setSetting(SETTING_USE_AA_FILTER, parameters.stretch_use_aa_filter);
+
+	m_soundtouch.setSetting(SETTING_SEQUENCE_MS, parameters.stretch_sequence_length_ms);
+	m_soundtouch.setSetting(SETTING_SEEKWINDOW_MS, parameters.stretch_seekwindow_ms);
+	m_soundtouch.setSetting(SETTING_OVERLAP_MS, parameters.stretch_overlap_ms);
+}
+
+SoundTouchStretcher::~SoundTouchStretcher() = default;
+
+void SoundTouchStretcher::SetTempo(float tempo)
+{
+	m_soundtouch.setTempo(tempo);
+}
+
+void SoundTouchStretcher::PutSamples(const float* samples, u32 num_frames)
+{
+	m_soundtouch.putSamples(samples, num_frames);
+}
+
+u32 SoundTouchStretcher::ReceiveSamples(float* samples, u32 max_frames)
+{
+	return m_soundtouch.receiveSamples(samples, max_frames);
+}
+
+void SoundTouchStretcher::Clear()
+{
+	m_soundtouch.clear();
+}
+
+WSOLAStretcher::WSOLAStretcher(u32 sample_rate, u32 channels, const AudioStreamParameters& parameters)
+	: m_channels(channels)
+	, m_quick_seek(parameters.stretch_use_quickseek)
+{
+	const auto ms_to_frames = [sample_rate](u32 ms) { return (sample_rate * ms) / 1000u; };
+
+	// Overlap is kept to a multiple of 8, so the half rate correlation is still a multiple of 4.
+	m_overlap = std::max((ms_to_frames(parameters.stretch_overlap_ms) + 7u) & ~7u, 16u);
+	m_sequence = std::max(ms_to_frames(parameters.stretch_sequence_length_ms), m_overlap * 2);
+	m_seek = std::max(ms_to_frames(parameters.stretch_seekwindow_ms), 1u);
+
+	m_input.reserve((m_seek + m_sequence * 2) * m_channels);
+	m_output.reserve(m_sequence * 2 * m_channels);
+	m_overlap_buffer.resize(m_overlap * m_channels);
+	m_overlap_mono.resize(m_overlap);
+	m_overlap_mono_half.resize(m_overlap / 2);
+	m_window_mono.resize(m_seek + m_overlap);
+	m_window_mono_half.resize((m_seek + m_overlap) / 2);
+}
+
+WSOLAStretcher::~WSOLAStretcher() = default;
+
+void WSOLAStretcher::SetTempo(float tempo)
+{
+	m_tempo = tempo;
+}
+
+void WSOLAStretcher::PutSamples(const float* samples, u32 num_frames)
+{
+	m_input.insert(m_input.end(), samples, samples + num_frames * m_channels);
+	Process();
+}
+
+u32 WSOLAStretcher::ReceiveSamples(float* samples, u32 max_frames)
+{
+	const u32 available = static_cast<u32>(m_output.size() / m_channels) - m_output_pos;
+	const u32 frames = std::min(available, max_frames);
+	if (frames == 0)
+		return 0;
+
+	std::memcpy(samples, &m_output[m_output_pos * m_channels], frames * m_channels * sizeof(float));
+	m_output_pos += frames;
+	if (m_output_pos * m_channels == m_output.size())
+	{
+		m_output.clear();
+		m_output_pos = 0;
+	}
+
+	return frames;
+}
+
+void WSOLAStretcher::Clear()
+{
+	m_input.clear();
+	m_input_pos = 0;
+	m_output.clear();
+	m_output_pos = 0;
+	m_have_overlap = false;
+	m_skip_fraction = 0.0;
+}
+
+void WSOLAStretcher::SetOverlap(const float* samples)
+{
+	std::memcpy(m_overlap_buffer.data(), samples, m_overlap * m_channels * sizeof(float));
+	for (u32 i = 0; i < m_overlap; i++)
+		m_overlap_mono[i] = (m_channels > 1) ? (samples[i * m_channels] + samples[i * m_channels + 1]) : samples[i];
+	for (u32 i = 0; i < m_overlap / 2; i++)
+		m_overlap_mono_half[i] = m_overlap_mono[i * 2] + m_overlap_mono[i * 2 + 1];
+}
+
+u32 WSOLAStretcher::FindBestOffset()
+{
+	// Mono is plenty for finding where the waveforms line up.
+	const float* in = &m_input[m_input_pos * m_channels];
+	const u32 window = m_seek + m_overlap;
+	for (u32 i = 0; i < window; i++)
+		m_window_mono[i] = (m_channels > 1) ? (in[i * m_channels] + in[i * m_channels + 1]) : in[i];
+	for (u32 i = 0; i < window / 2; i++)
+		m_window_mono_half[i] = m_window_mono[i * 2] + m_window_mono[i * 2 + 1];
+
+	const auto score = [](const float* ref, const float* win, u32 count) {
+		GSVector4 corr = GSVector4::zero();
+		GSVector4 energy = GSVector4::zero();
+		for (u32 i = 0; i < count; i += 4)
+		{
+			const GSVector4 r = GSVector4::load<false>(&ref[i]);
+			const GSVector4 w = GSVector4::load<false>(&win[i]);
+			corr += r * w;
+			energy += w * w;
+		}
+
+		// Normalise, so loud sections of the window don't win just for being loud.
+		return corr.hadd().hadd().x / std::sqrt(energy.hadd().hadd().x + 1e-6f);
+	};
+
+	// Coarse pass at half rate, which is a quarter of the work, then refine around the winner at full rate.
+	u32 best_offset = 0;
+	float best_score = -std::numeric_limits<float>::infinity();
+	const u32 coarse_step = m_quick_seek ? 4 : 1;
+	for (u32 offset = 0; offset < m_seek / 2; offset += coarse_step)
+	{
+		const float s = score(m_overlap_mono_half.data(), &m_window_mono_half[offset], m_overlap / 2);
+		if (s > best_score)
+		{
+			best_score = s;
+			best_offset = offset * 2;
+		}
+	}
+
+	const u32 radius = coarse_step * 2 - 1;
+	const u32 start = (best_offset > radius) ? (best_offset - radius) : 0;
+	const u32 end = std::min(best_offset + radius + 1, m_seek);
+	best_score = -std::numeric_limits<float>::infinity();
+	for (u32 offset = start; offset < end; offset++)
+	{
+		const float s = score(m_overlap_mono.data(), &m_window_mono[offset], m_overlap);
+		if (s > best_score)
+		{
+			best_score = s;
+			best_offset = offset;
+		}
+	}
+
+	return best_offset;
+}
+
+void WSOLAStretcher::Process()
+{
+	while (GetInputFrames() >= (m_seek + m_sequence))
+	{
+		const u32 offset = m_have_overlap ? FindBestOffset() : 0;
+		const float* in = &m_input[(m_input_pos + offset) * m_channels];
+
+		const size_t out_start = m_output.size();
+		m_output.resize(out_start + (m_sequence - m_overlap) * m_channels);
+		float* out = &m_output[out_start];
+
+		// Crossfade from the tail of the last sequence into this one.
+		const u32 overlap_samples = m_overlap * m_channels;
+		if (m_have_overlap)
+		{
+			const float step = 1.0f / static_cast<float>(m_overlap);
+			for (u32 i = 0; i < m_overlap; i++)
+			{
+				const float fade_in = (static_cast<float>(i) + 0.5f) * step;
+				for (u32 c = 0; c < m_channels; c++)
+				{
+					const u32 idx = i * m_channels + c;
+					out[idx] = m_overlap_buffer[idx] + (in[idx] - m_overlap_buffer[idx]) * fade_in;
+				}
+			}
+		}
+		else
+		{
+			std::memcpy(out, in, overlap_samples * sizeof(float));
+		}
+
+		const u32 middle_frames = m_sequence - m_overlap * 2;
+		std::memcpy(out + overlap_samples, in + overlap_samples, middle_frames * m_channels * sizeof(float));
+		SetOverlap(in + (m_sequence - m_overlap) * m_channels);
+		m_have_overlap = true;
+
+		// Move on by however much input one sequence of output represents at this tempo.
+		const double skip = static_cast<double>(m_tempo) * static_cast<double>(m_sequence - m_overlap) + m_skip_fraction;
+		const u32 whole = static_cast<u32>(skip);
+		m_skip_fraction = skip - static_cast<double>(whole);
+		m_input_pos += std::min(whole, GetInputFrames());
+	}
+
+	// Shift what's left to the front, so the buffer doesn't keep growing.
+	if (m_input_pos > 0)
+	{
+		m_input.erase(m_input.begin(), m_input.begin() + m_input_pos * m_channels);
+		m_input_pos = 0;
+	}
+}
+
+std::unique_ptr<AudioStretcher> AudioStretcher::Create(AudioStretchMode mode, u32 sample_rate, u32 channels,
+	const AudioStreamParameters& parameters)
+{
+	switch (mode)
+	{
+		case AudioStretchMode::WSOLA:
+			return std::make_unique<WSOLAStretcher>(sample_rate, channels, parameters);
+
+		case AudioStretchMode::SoundTouch:
+		default:
+			return std::make_unique<SoundTouchStretcher>(sample_rate, channels, parameters);
+	}
+}
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "Host/AudioStreamTypes.h"
+
+#include <memory>
+
+/// Changes the tempo of interleaved float audio without changing its pitch.
+/// Input is pushed in with PutSamples(), and whatever output is ready is pulled with ReceiveSamples().
+class AudioStretcher
+{
+public:
+	virtual ~AudioStretcher();
+
+	static std::unique_ptr<AudioStretcher> Create(AudioStretchMode mode, u32 sample_rate, u32 channels,
+		const AudioStreamParameters& parameters);
+
+	virtual void SetTempo(float tempo) = 0;
+	virtual void PutSamples(const float* samples, u32 num_frames) = 0;
+	virtual u32 ReceiveSamples(float* samples, u32 max_frames) = 0;
+
+	/// Drops all buffered input and output.
+	virtual void Clear() = 0;
+
+protected:
+	AudioStretcher();
+};
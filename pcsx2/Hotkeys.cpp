@@ -10,6 +10,7 @@
 #include "Input/InputManager.h"
 #include "Recording/InputRecording.h"
 #include "SPU2/spu2.h"
+#include "Tracing.h"
 #include "VMManager.h"
 #include "SIO/Memcard/MemoryCardFile.h"
 
@@ -117,6 +118,40 @@ static void HotkeySaveStateSlot(s32 slot)
 	});
 }
 
+static void HotkeyToggleFrameTrace()
+{
+	if (!Tracing::IsEnabled())
+	{
+		Tracing::Start();
+		Host::AddIconOSDMessage("FrameTrace", ICON_FA_CHART_GANTT,
+			TRANSLATE_STR("Hotkeys", "Frame trace started."), Host::OSD_QUICK_DURATION);
+		return;
+	}
+
+	Tracing::Stop();
+
+	const time_t cur_time = time(nullptr);
+	char local_time[16];
+	if (!strftime(local_time, sizeof(local_time), "%Y%m%d%H%M%S", localtime(&cur_time)))
+		local_time[0] = '\0';
+
+	const std::string path = Path::Combine(EmuFolders::Logs, fmt::format("frametrace_{}.json", local_time));
+
+	Error error;
+	if (Tracing::ExportChromeTrace(path, &error))
+	{
+		Host::AddIconOSDMessage("FrameTrace", ICON_FA_CHART_GANTT,
+			fmt::format(TRANSLATE_FS("Hotkeys", "Frame trace saved to {}."), Path::GetFileName(path)),
+			Host::OSD_INFO_DURATION);
+	}
+	else
+	{
+		Host::AddIconOSDMessage("FrameTrace", ICON_FA_TRIANGLE_EXCLAMATION,
+			fmt::format(TRANSLATE_FS("Hotkeys", "Failed to save frame trace: {}"), error.GetDescription()),
+			Host::OSD_ERROR_DURATION);
+	}
+}
+
 static bool CanPause()
 {
 	static constexpr const float PAUSE_INTERVAL = 3.0f;
@@ -250,6 +285,11 @@ DEFINE_HOTKEY("ReloadPatches", TRANSLATE_NOOP("Hotkeys", "System"), TRANSLATE_NO
 			});
 		}
 	})
+DEFINE_HOTKEY("ToggleFrameTrace", TRANSLATE_NOOP("Hotkeys", "System"),
+	TRANSLATE_NOOP("Hotkeys", "Start/Stop Frame Trace"), [](s32 pressed) {
+		if (!pressed && VMManager::HasValidVM())
+			HotkeyToggleFrameTrace();
+	})
 DEFINE_HOTKEY("SwapMemCards", TRANSLATE_NOOP("Hotkeys", "System"),
 	TRANSLATE_NOOP("Hotkeys", "Swap Memory Cards"), [](s32 pressed) {
 		if (!pressed && VMManager::HasValidVM())
@@ -143,6 +143,8 @@ alignas(16) extern tIPU_BP g_BP;
 
 MULTI_ISA_DEF(
 	extern void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte);
+	extern void ipu_idct(s16* block);
+	extern void ipu_idct_reference(s16* block);
 
 	void IPUWorker();
 )
@@ -161,5 +163,4 @@ struct mpeg2_scan_pack
 	u8 alt[64];
 };
 
-alignas(16) extern const std::array<u8, 1024> g_idct_clip_lut;
 alignas(16) extern const mpeg2_scan_pack mpeg2_scan;
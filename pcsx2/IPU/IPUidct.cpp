@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-2.0+
+
+// The reference IDCT in this file is based on the mpeg2dec library,
+//
+// Copyright (C) 2000-2002 Michel Lespinasse <walken@zoy.org>
+// Copyright (C) 1999-2000 Aaron Holtzman <aholtzma@ess.engr.uvic.ca>
+//
+// under the GPL license. The original author's copyright statement is included
+// above for completeness sake.
+
+#include "Common.h"
+
+#include "IPU/IPU.h"
+#include "IPU/IPU_MultiISA.h"
+
+MULTI_ISA_UNSHARED_START
+
+#define W1 2841 /* 2048*sqrt (2)*cos (1*pi/16) */
+#define W2 2676 /* 2048*sqrt (2)*cos (2*pi/16) */
+#define W3 2408 /* 2048*sqrt (2)*cos (3*pi/16) */
+#define W5 1609 /* 2048*sqrt (2)*cos (5*pi/16) */
+#define W6 1108 /* 2048*sqrt (2)*cos (6*pi/16) */
+#define W7 565  /* 2048*sqrt (2)*cos (7*pi/16) */
+
+/*
+ * In legal streams, the IDCT output should be between -384 and +384.
+ * In corrupted streams, it is possible to force the IDCT output to go
+ * to +-3826 - this is the worst case for a column IDCT where the
+ * column inputs are 16-bit values.
+ */
+
+__fi static void BUTTERFLY(int& t0, int& t1, int w0, int w1, int d0, int d1)
+{
+	int tmp = w0 * (d0 + d1);
+	t0 = tmp + (w1 - w0) * d1;
+	t1 = tmp - (w1 + w0) * d0;
+}
+
+__ri static void IDCT_Block(s16* block)
+{
+	for (int i = 0; i < 8; i++)
+	{
+		s16* const rblock = block + 8 * i;
+		if (!(rblock[1] | ((s32*)rblock)[1] | ((s32*)rblock)[2] |
+				((s32*)rblock)[3]))
+		{
+			u32 tmp = (u16)(rblock[0] << 3);
+			tmp |= tmp << 16;
+			((s32*)rblock)[0] = tmp;
+			((s32*)rblock)[1] = tmp;
+			((s32*)rblock)[2] = tmp;
+			((s32*)rblock)[3] = tmp;
+			continue;
+		}
+
+		int a0, a1, a2, a3;
+		{
+			const int d0 = (rblock[0] << 11) + 128;
+			const int d1 = rblock[1];
+			const int d2 = rblock[2] << 11;
+			const int d3 = rblock[3];
+			int t0 = d0 + d2;
+			int t1 = d0 - d2;
+			int t2, t3;
+			BUTTERFLY(t2, t3, W6, W2, d3, d1);
+			a0 = t0 + t2;
+			a1 = t1 + t3;
+			a2 = t1 - t3;
+			a3 = t0 - t2;
+		}
+
+		int b0, b1, b2, b3;
+		{
+			const int d0 = rblock[4];
+			const int d1 = rblock[5];
+			const int d2 = rblock[6];
+			const int d3 = rblock[7];
+			int t0, t1, t2, t3;
+			BUTTERFLY(t0, t1, W7, W1, d3, d0);
+			BUTTERFLY(t2, t3, W3, W5, d1, d2);
+			b0 = t0 + t2;
+			b3 = t1 + t3;
+			t0 -= t2;
+			t1 -= t3;
+			b1 = ((t0 + t1) * 181) >> 8;
+			b2 = ((t0 - t1) * 181) >> 8;
+		}
+
+		rblock[0] = (a0 + b0) >> 8;
+		rblock[1] = (a1 + b1) >> 8;
+		rblock[2] = (a2 + b2) >> 8;
+		rblock[3] = (a3 + b3) >> 8;
+		rblock[4] = (a3 - b3) >> 8;
+		rblock[5] = (a2 - b2) >> 8;
+		rblock[6] = (a1 - b1) >> 8;
+		rblock[7] = (a0 - b0) >> 8;
+	}
+
+	for (int i = 0; i < 8; i++)
+	{
+		s16* const cblock = block + i;
+
+		int a0, a1, a2, a3;
+		{
+			const int d0 = (cblock[8 * 0] << 11) + 65536;
+			const int d1 = cblock[8 * 1];
+			const int d2 = cblock[8 * 2] << 11;
+			const int d3 = cblock[8 * 3];
+			const int t0 = d0 + d2;
+			const int t1 = d0 - d2;
+			int t2;
+			int t3;
+			BUTTERFLY(t2, t3, W6, W2, d3, d1);
+			a0 = t0 + t2;
+			a1 = t1 + t3;
+			a2 = t1 - t3;
+			a3 = t0 - t2;
+		}
+
+		int b0, b1, b2, b3;
+		{
+			const int d0 = cblock[8 * 4];
+			const int d1 = cblock[8 * 5];
+			const int d2 = cblock[8 * 6];
+			const int d3 = cblock[8 * 7];
+			int t0, t1, t2, t3;
+			BUTTERFLY(t0, t1, W7, W1, d3, d0);
+			BUTTERFLY(t2, t3, W3, W5, d1, d2);
+			b0 = t0 + t2;
+			b3 = t1 + t3;
+			t0 = (t0 - t2) >> 8;
+			t1 = (t1 - t3) >> 8;
+			b1 = (t0 + t1) * 181;
+			b2 = (t0 - t1) * 181;
+		}
+
+		cblock[8 * 0] = (a0 + b0) >> 17;
+		cblock[8 * 1] = (a1 + b1) >> 17;
+		cblock[8 * 2] = (a2 + b2) >> 17;
+		cblock[8 * 3] = (a3 + b3) >> 17;
+		cblock[8 * 4] = (a3 - b3) >> 17;
+		cblock[8 * 5] = (a2 - b2) >> 17;
+		cblock[8 * 6] = (a1 - b1) >> 17;
+		cblock[8 * 7] = (a0 - b0) >> 17;
+	}
+}
+
+#if defined(_M_X86) && _M_SSE >= 0x501
+
+// Same integer maths as IDCT_Block(), so the results are bit-exact. The row pass works
+// on all 8 rows at once (one per 32-bit lane), then the column pass on all 8 columns.
+
+__fi static __m256i idct_mul(const __m256i& a, int w)
+{
+	return _mm256_mullo_epi32(a, _mm256_set1_epi32(w));
+}
+
+__fi static void idct_butterfly(__m256i& t0, __m256i& t1, int w0, int w1, const __m256i& d0, const __m256i& d1)
+{
+	const __m256i tmp = idct_mul(_mm256_add_epi32(d0, d1), w0);
+	t0 = _mm256_add_epi32(tmp, idct_mul(d1, w1 - w0));
+	t1 = _mm256_sub_epi32(tmp, idct_mul(d0, w1 + w0));
+}
+
+__fi static void idct_transpose(__m128i* r)
+{
+	const __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+	const __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+	const __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+	const __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+	const __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+	const __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+	const __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+	const __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+	const __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+	const __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+	const __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+	const __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+	const __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+	const __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+	const __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+	const __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+	r[0] = _mm_unpacklo_epi64(b0, b4);
+	r[1] = _mm_unpackhi_epi64(b0, b4);
+	r[2] = _mm_unpacklo_epi64(b1, b5);
+	r[3] = _mm_unpackhi_epi64(b1, b5);
+	r[4] = _mm_unpacklo_epi64(b2, b6);
+	r[5] = _mm_unpackhi_epi64(b2, b6);
+	r[6] = _mm_unpacklo_epi64(b3, b7);
+	r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+// Truncates each 32-bit lane to s16, like the stores to the s16 block in IDCT_Block().
+__fi static __m128i idct_narrow(const __m256i& v)
+{
+	const __m256i t = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+	return _mm_packs_epi32(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+}
+
+template <bool column>
+__fi static void idct_pass(__m128i* r)
+{
+	__m256i d[8];
+	for (int i = 0; i < 8; i++)
+		d[i] = _mm256_cvtepi16_epi32(r[i]);
+
+	__m256i a0, a1, a2, a3;
+	{
+		const __m256i d0 = _mm256_add_epi32(_mm256_slli_epi32(d[0], 11), _mm256_set1_epi32(column ? 65536 : 128));
+		const __m256i d2 = _mm256_slli_epi32(d[2], 11);
+		const __m256i t0 = _mm256_add_epi32(d0, d2);
+		const __m256i t1 = _mm256_sub_epi32(d0, d2);
+		__m256i t2, t3;
+		idct_butterfly(t2, t3, W6, W2, d[3], d[1]);
+		a0 = _mm256_add_epi32(t0, t2);
+		a1 = _mm256_add_epi32(t1, t3);
+		a2 = _mm256_sub_epi32(t1, t3);
+		a3 = _mm256_sub_epi32(t0, t2);
+	}
+
+	__m256i b0, b1, b2, b3;
+	{
+		__m256i t0, t1, t2, t3;
+		idct_butterfly(t0, t1, W7, W1, d[7], d[4]);
+		idct_butterfly(t2, t3, W3, W5, d[5], d[6]);
+		b0 = _mm256_add_epi32(t0, t2);
+		b3 = _mm256_add_epi32(t1, t3);
+		t0 = _mm256_sub_epi32(t0, t2);
+		t1 = _mm256_sub_epi32(t1, t3);
+		if (column)
+		{
+			t0 = _mm256_srai_epi32(t0, 8);
+			t1 = _mm256_srai_epi32(t1, 8);
+			b1 = idct_mul(_mm256_add_epi32(t0, t1), 181);
+			b2 = idct_mul(_mm256_sub_epi32(t0, t1), 181);
+		}
+		else
+		{
+			b1 = _mm256_srai_epi32(idct_mul(_mm256_add_epi32(t0, t1), 181), 8);
+			b2 = _mm256_srai_epi32(idct_mul(_mm256_sub_epi32(t0, t1), 181), 8);
+		}
+	}
+
+	constexpr int shift = column ? 17 : 8;
+	r[0] = idct_narrow(_mm256_srai_epi32(_mm256_add_epi32(a0, b0), shift));
+	r[1] = idct_narrow(_mm256_srai_epi32(_mm256_add_epi32(a1, b1), shift));
+	r[2] = idct_narrow(_mm256_srai_epi32(_mm256_add_epi32(a2, b2), shift));
+	r[3] = idct_narrow(_mm256_srai_epi32(_mm256_add_epi32(a3, b3), shift));
+	r[4] = idct_narrow(_mm256_srai_epi32(_mm256_sub_epi32(a3, b3), shift));
+	r[5] = idct_narrow(_mm256_srai_epi32(_mm256_sub_epi32(a2, b2), shift));
+	r[6] = idct_narrow(_mm256_srai_epi32(_mm256_sub_epi32(a1, b1), shift));
+	r[7] = idct_narrow(_mm256_srai_epi32(_mm256_sub_epi32(a0, b0), shift));
+}
+
+__ri static void IDCT_Block_AVX2(s16* block)
+{
+	__m128i r[8];
+	for (int i = 0; i < 8; i++)
+		r[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(block + 8 * i));
+
+	// Rows go into lanes for the row pass, and then back for the column pass.
+	idct_transpose(r);
+	idct_pass<false>(r);
+	idct_transpose(r);
+	idct_pass<true>(r);
+
+	for (int i = 0; i < 8; i++)
+		_mm_store_si128(reinterpret_cast<__m128i*>(block + 8 * i), r[i]);
+}
+
+#endif
+
+// conforming implementation for reference, do not optimise
+void ipu_idct_reference(s16* block)
+{
+	IDCT_Block(block);
+}
+
+void ipu_idct(s16* block)
+{
+#if defined(_M_X86) && _M_SSE >= 0x501
+	IDCT_Block_AVX2(block);
+#else
+	IDCT_Block(block);
+#endif
+}
+
+MULTI_ISA_UNSHARED_END
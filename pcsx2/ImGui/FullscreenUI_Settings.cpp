@@ -2618,6 +2618,14 @@ void FullscreenUI::DrawEmulationSettingsPage()
 		FSUI_CSTR("Disables PCSX2's internal frame timing, and uses host vsync instead."), "EmuCore/GS", "UseVSyncForTiming", false,
 		GetEffectiveBoolSetting(bsi, "EmuCore/GS", "VsyncEnable", false) && GetEffectiveBoolSetting(bsi, "EmuCore/GS", "SyncToHostRefreshRate", false));
 
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_STOPWATCH, "Latency-Reduced Pacing"),
+		FSUI_CSTR("Starts each frame as late as vsync allows, so input is read closer to when the frame is shown."), "Framerate",
+		"LatencyReducedPacing", false, GetEffectiveBoolSetting(bsi, "EmuCore/GS", "VsyncEnable", false));
+
+	DrawIntRangeSetting(bsi, FSUI_ICONSTR(ICON_FA_FORWARD, "Run-Ahead"),
+		FSUI_CSTR("Emulates frames ahead of the one shown and rolls them back, hiding the game's own input lag. Software renderer only."),
+		"Framerate", "RunAheadFrames", 0, 0, Pcsx2Config::EmulationSpeedOptions::MAX_RUN_AHEAD_FRAMES, FSUI_CSTR("%d Frames"));
+
 	EndMenuButtons();
 }
 
@@ -3501,6 +3509,10 @@ void FullscreenUI::DrawAudioSettingsPage()
 		"SPU2/Output", "SyncMode", Pcsx2Config::SPU2Options::DEFAULT_SYNC_MODE,
 		&Pcsx2Config::SPU2Options::ParseSyncMode, &Pcsx2Config::SPU2Options::GetSyncModeName,
 		&Pcsx2Config::SPU2Options::GetSyncModeDisplayName, Pcsx2Config::SPU2Options::SPU2SyncMode::Count);
+	DrawEnumSetting(bsi, FSUI_ICONSTR(ICON_FA_ARROWS_SPIN, "Time Stretch Engine"),
+		FSUI_CSTR("Selects the algorithm used to keep audio in sync when time stretching. The lightweight engine uses less CPU."),
+		"SPU2/Output", "StretchMode", AudioStreamParameters::DEFAULT_STRETCH_MODE, &AudioStream::ParseStretchMode,
+		&AudioStream::GetStretchModeName, &AudioStream::GetStretchModeDisplayName, AudioStretchMode::Count);
 	DrawIntRangeSetting(bsi, FSUI_ICONSTR(ICON_FA_BUCKET, "Buffer Size"),
 		FSUI_CSTR("Determines the amount of audio buffered before being pulled by the host API."),
 		"SPU2/Output", "BufferMS", AudioStreamParameters::DEFAULT_BUFFER_MS, 10, 500, FSUI_CSTR("%d ms"));
@@ -3515,6 +3527,9 @@ void FullscreenUI::DrawAudioSettingsPage()
 	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_STOPWATCH, "Minimal Output Latency"),
 		FSUI_CSTR("When enabled, the minimum supported output latency will be used for the host API."),
 		"SPU2/Output", "OutputLatencyMinimal", AudioStreamParameters::DEFAULT_OUTPUT_LATENCY_MINIMAL);
+	DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_BUCKET, "Adaptive Buffer Size"),
+		FSUI_CSTR("When enabled with time stretching, the buffer shrinks to what the host API needs, using the buffer size as an upper limit."),
+		"SPU2/Output", "AdaptiveBuffer", AudioStreamParameters::DEFAULT_ADAPTIVE_BUFFER);
 
 	EndMenuButtons();
 }
@@ -4939,6 +4954,9 @@ void FullscreenUI::DrawAdvancedSettingsPage()
 		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_MEMORY, "Enable Fast Memory Access"),
 			FSUI_CSTR("Uses backpatching to avoid register flushing on every memory access."), "EmuCore/CPU/Recompiler", "EnableFastmem",
 			true);
+		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_MEMORY, "Enable Sub-Page Code Write Tracking"),
+			FSUI_CSTR("Only discards code next to the written data when a game writes to a page holding code. Requires fast memory access."),
+			"EmuCore/CPU/Recompiler", "EnableSubPageSMC", false, GetEffectiveBoolSetting(bsi, "EmuCore/CPU/Recompiler", "EnableFastmem", true));
 
 		MenuHeading(FSUI_CSTR("Vector Units"));
 		DrawIntListSetting(bsi, FSUI_ICONSTR(ICON_FA_ARROW_TREND_DOWN, "VU0 Rounding Mode"),
@@ -4964,6 +4982,13 @@ void FullscreenUI::DrawAdvancedSettingsPage()
 		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_CLOCK, "Enable Instant VU1"),
 			FSUI_CSTR("Runs VU1 instantly. Provides a modest speed improvement in most games. Safe for most games, but a few games may exhibit graphical errors."),
 			"EmuCore/Speedhacks", "vu1Instant", true);
+		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_HARD_DRIVE, "Enable VU Program Cache"),
+			FSUI_CSTR("Stores microprograms on disk and recompiles them when the game starts, reducing stutter the first time a scene is shown."),
+			"EmuCore/CPU/Recompiler", "EnableVUProgramCache", false);
+		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_MICROCHIP, "Enable Background VU1 Compilation"),
+			FSUI_CSTR("Compiles new VU1 microprograms on a separate thread, interpreting them until ready. Has no effect with MTVU."),
+			"EmuCore/CPU/Recompiler", "EnableVU1AsyncCompile", false,
+			!GetEffectiveBoolSetting(bsi, "EmuCore/Speedhacks", "vuThread", false));
 
 		MenuHeading(FSUI_CSTR("I/O Processor"));
 		DrawToggleSetting(bsi, FSUI_ICONSTR(ICON_FA_MICROCHIP, "Enable IOP Recompiler"),
@@ -5242,6 +5267,9 @@ TRANSLATE_NOOP("FullscreenUI", "Synchronize EE and GS threads after each frame.
 TRANSLATE_NOOP("FullscreenUI", "Synchronizes frame presentation with host refresh.");
 TRANSLATE_NOOP("FullscreenUI", "Speeds up emulation so that the guest refresh rate matches the host.");
 TRANSLATE_NOOP("FullscreenUI", "Disables PCSX2's internal frame timing, and uses host vsync instead.");
+TRANSLATE_NOOP("FullscreenUI", "Starts each frame as late as vsync allows, so input is read closer to when the frame is shown.");
+TRANSLATE_NOOP("FullscreenUI", "Emulates frames ahead of the one shown and rolls them back, hiding the game's own input lag. Software renderer only.");
+TRANSLATE_NOOP("FullscreenUI", "%d Frames");
 TRANSLATE_NOOP("FullscreenUI", "Graphics API");
 TRANSLATE_NOOP("FullscreenUI", "Selects the API used to render the emulated GS.");
 TRANSLATE_NOOP("FullscreenUI", "Display");
@@ -5373,6 +5401,7 @@ TRANSLATE_NOOP("FullscreenUI", "Determines the amount of audio buffered before b
 TRANSLATE_NOOP("FullscreenUI", "%d ms");
 TRANSLATE_NOOP("FullscreenUI", "Determines how much latency there is between the audio being picked up by the host API, and played through speakers.");
 TRANSLATE_NOOP("FullscreenUI", "When enabled, the minimum supported output latency will be used for the host API.");
+TRANSLATE_NOOP("FullscreenUI", "When enabled with time stretching, the buffer shrinks to what the host API needs, using the buffer size as an upper limit.");
 TRANSLATE_NOOP("FullscreenUI", "Settings and Operations");
 TRANSLATE_NOOP("FullscreenUI", "Creates a new memory card file or folder.");
 TRANSLATE_NOOP("FullscreenUI", "Simulates a larger memory card by filtering saves only to the current game.");
@@ -5792,6 +5821,8 @@ TRANSLATE_NOOP("FullscreenUI", "Optimal Frame Pacing");
 TRANSLATE_NOOP("FullscreenUI", "Vertical Sync (VSync)");
 TRANSLATE_NOOP("FullscreenUI", "Sync to Host Refresh Rate");
 TRANSLATE_NOOP("FullscreenUI", "Use Host VSync Timing");
+TRANSLATE_NOOP("FullscreenUI", "Latency-Reduced Pacing");
+TRANSLATE_NOOP("FullscreenUI", "Run-Ahead");
 TRANSLATE_NOOP("FullscreenUI", "Aspect Ratio");
 TRANSLATE_NOOP("FullscreenUI", "FMV Aspect Ratio Override");
 TRANSLATE_NOOP("FullscreenUI", "Deinterlacing");
@@ -5909,6 +5940,9 @@ TRANSLATE_NOOP("FullscreenUI", "Synchronization");
 TRANSLATE_NOOP("FullscreenUI", "Buffer Size");
 TRANSLATE_NOOP("FullscreenUI", "Output Latency");
 TRANSLATE_NOOP("FullscreenUI", "Minimal Output Latency");
+TRANSLATE_NOOP("FullscreenUI", "Adaptive Buffer Size");
+TRANSLATE_NOOP("FullscreenUI", "Time Stretch Engine");
+TRANSLATE_NOOP("FullscreenUI", "Selects the algorithm used to keep audio in sync when time stretching. The lightweight engine uses less CPU.");
 TRANSLATE_NOOP("FullscreenUI", "Create Memory Card");
 TRANSLATE_NOOP("FullscreenUI", "Memory Card Directory");
 TRANSLATE_NOOP("FullscreenUI", "Folder Memory Card Filter");
@@ -61,14 +61,18 @@ SmallString s_speed_line;
 SmallString s_gs_stats_line;
 SmallString s_gs_memory_stats_line;
 SmallString s_gs_frame_times_line;
+SmallString s_gs_frame_lows_line;
+SmallString s_gs_stutter_line;
 SmallString s_resolution_line;
 SmallString s_hardware_info_cpu_line;
 SmallString s_hardware_info_gpu_line;
 SmallString s_cpu_usage_ee_line;
 SmallString s_cpu_usage_gs_line;
 SmallString s_cpu_usage_vu_line;
+SmallString s_mtvu_wait_line;
 std::vector<SmallString> s_software_thread_lines;
 SmallString s_capture_line;
+SmallString s_audio_line;
 SmallString s_gpu_usage_line;
 SmallString s_gpu_debug_info_line;
 SmallString s_speed_icon;
@@ -400,11 +404,38 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 					PerformanceMetrics::GetAverageFrameTime(),
 					PerformanceMetrics::GetMaximumFrameTime());
 
+				s_gs_frame_lows_line.format("1% Low: {:.2f}ms | 0.1% Low: {:.2f}ms | Stutters: {}",
+					PerformanceMetrics::GetOnePercentLowFrameTime(),
+					PerformanceMetrics::GetPointOnePercentLowFrameTime(),
+					PerformanceMetrics::GetStutterCount());
+
+				s_gs_stutter_line.clear();
+				if (const auto& stutters = PerformanceMetrics::GetStutterLog(); !stutters.empty())
+				{
+					const PerformanceMetrics::StutterEvent& last = stutters.back();
+					s_gs_stutter_line.format("Last Stutter: {:.2f}ms (", last.frame_time);
+					bool has_source = false;
+					for (u32 i = 0; i < PerformanceMetrics::NUM_STUTTER_SOURCES; i++)
+					{
+						if (last.sources[i] == 0)
+							continue;
+
+						s_gs_stutter_line.append_format("{}{} x{}", has_source ? ", " : "",
+							PerformanceMetrics::GetStutterSourceName(static_cast<PerformanceMetrics::StutterSource>(i)),
+							last.sources[i]);
+						has_source = true;
+					}
+					s_gs_stutter_line.append(has_source ? ")" : "Unknown)");
+				}
+
 				if (!s_gs_stats_line.empty())
 					DRAW_LINE(osd_font, font_size, s_gs_stats_line.c_str(), white_color);
 				if (!s_gs_memory_stats_line.empty())
 					DRAW_LINE(osd_font, font_size, s_gs_memory_stats_line.c_str(), white_color);
 				DRAW_LINE(osd_font, font_size, s_gs_frame_times_line.c_str(), white_color);
+				DRAW_LINE(osd_font, font_size, s_gs_frame_lows_line.c_str(), white_color);
+				if (!s_gs_stutter_line.empty())
+					DRAW_LINE(osd_font, font_size, s_gs_stutter_line.c_str(), white_color);
 			}
 
 			if (GSConfig.OsdShowResolution)
@@ -461,6 +492,12 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 					s_cpu_usage_vu_line.assign("VU: ");
 					FormatProcessorStat(s_cpu_usage_vu_line, PerformanceMetrics::GetVUThreadUsage(), PerformanceMetrics::GetVUThreadAverageTime());
 					DRAW_LINE(osd_font, font_size, s_cpu_usage_vu_line.c_str(), white_color);
+
+					using PerformanceMetrics::MTVUWaitReason;
+					s_mtvu_wait_line.format("VU Waits: {:.1f} ({:.2f}ms) | Full: {:.1f} ({:.2f}ms)",
+						PerformanceMetrics::GetMTVUWaitCount(MTVUWaitReason::Sync), PerformanceMetrics::GetMTVUWaitAverageTime(MTVUWaitReason::Sync),
+						PerformanceMetrics::GetMTVUWaitCount(MTVUWaitReason::RingFull), PerformanceMetrics::GetMTVUWaitAverageTime(MTVUWaitReason::RingFull));
+					DRAW_LINE(osd_font, font_size, s_mtvu_wait_line.c_str(), white_color);
 				}
 
 				const u32 gs_sw_threads = PerformanceMetrics::GetGSSWThreadCount();
@@ -480,6 +517,10 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 					FormatProcessorStat(s_capture_line, PerformanceMetrics::GetCaptureThreadUsage(), PerformanceMetrics::GetCaptureThreadAverageTime());
 					DRAW_LINE(osd_font, font_size, s_capture_line.c_str(), white_color);
 				}
+
+				s_audio_line.format("SPU2: {:.1f}ms | Underruns: {} | Overruns: {}", PerformanceMetrics::GetAudioLatency(),
+					PerformanceMetrics::GetAudioUnderrunCount(), PerformanceMetrics::GetAudioOverrunCount());
+				DRAW_LINE(osd_font, font_size, s_audio_line.c_str(), white_color);
 			}
 
 			if (GSConfig.OsdShowGPU)
@@ -518,6 +559,9 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 				if (!s_gs_memory_stats_line.empty())
 					DRAW_LINE(osd_font, font_size, s_gs_memory_stats_line.c_str(), white_color);
 				DRAW_LINE(osd_font, font_size, s_gs_frame_times_line.c_str(), white_color);
+				DRAW_LINE(osd_font, font_size, s_gs_frame_lows_line.c_str(), white_color);
+				if (!s_gs_stutter_line.empty())
+					DRAW_LINE(osd_font, font_size, s_gs_stutter_line.c_str(), white_color);
 			}
 
 			if (GSConfig.OsdShowResolution)
@@ -534,7 +578,10 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 				DRAW_LINE(osd_font, font_size, s_cpu_usage_ee_line.c_str(), white_color);
 				DRAW_LINE(osd_font, font_size, s_cpu_usage_gs_line.c_str(), white_color);
 				if (THREAD_VU1)
+				{
 					DRAW_LINE(osd_font, font_size, s_cpu_usage_vu_line.c_str(), white_color);
+					DRAW_LINE(osd_font, font_size, s_mtvu_wait_line.c_str(), white_color);
+				}
 
 				const u32 thread_count = std::min(
 					PerformanceMetrics::GetGSSWThreadCount(),
@@ -544,6 +591,8 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 
 				if (GSCapture::IsCapturing())
 					DRAW_LINE(osd_font, font_size, s_capture_line.c_str(), white_color);
+
+				DRAW_LINE(osd_font, font_size, s_audio_line.c_str(), white_color);
 			}
 
 			if (GSConfig.OsdShowGPU)
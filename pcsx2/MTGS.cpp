@@ -7,6 +7,7 @@
 #include "MTVU.h"
 #include "Host.h"
 #include "IconsFontAwesome.h"
+#include "Tracing.h"
 #include "VMManager.h"
 
 #include "common/FPControl.h"
@@ -144,6 +145,7 @@ void MTGS::ShutdownThread()
 void MTGS::ThreadEntryPoint()
 {
 	Threading::SetNameOfCurrentThread("GS");
+	Tracing::SetThreadName("GS");
 
 	// GS can hit SMC write traps when executing InitAndReadFIFO
 	// As racey as it sounds, it should be safe, since InitAndReadFIFO is requested and immediately waited for,
@@ -233,10 +235,12 @@ struct RingCmdPacket_Vsync
 
 	// must be 16 byte aligned
 	u32 registers_written;
-	u32 pad[3];
+	u32 hidden;
+	u32 run_ahead;
+	u32 pad;
 };
 
-void MTGS::PostVsyncStart(bool registers_written)
+void MTGS::PostVsyncStart(bool registers_written, bool hidden, bool run_ahead)
 {
 	// Optimization note: Typically regset1 isn't needed.  The regs in that area are typically
 	// changed infrequently, usually during video mode changes.  However, on modern systems the
@@ -252,6 +256,8 @@ void MTGS::PostVsyncStart(bool registers_written)
 	remainder[1] = GSIMR._u32;
 	(GSRegSIGBLID&)remainder[2] = GSSIGLBLID;
 	remainder[4] = static_cast<u32>(registers_written);
+	remainder[5] = static_cast<u32>(hidden);
+	remainder[6] = static_cast<u32>(run_ahead);
 	s_packet_writepos = (s_packet_writepos + 2) & RingBufferMask;
 
 	SendDataPacket();
@@ -342,6 +348,8 @@ void MTGS::MainLoop()
 		if (!s_open_flag.load(std::memory_order_acquire))
 			break;
 
+		TRACE_ZONE("GS Ring");
+
 		// note: m_ReadPos is intentionally not volatile, because it should only
 		// ever be modified by this thread.
 		while (s_ReadPos.load(std::memory_order_relaxed) != s_WritePos.load(std::memory_order_acquire))
@@ -500,7 +508,7 @@ void MTGS::MainLoop()
 							((GSRegSIGBLID&)RingBuffer.Regs[0x1080]) = (GSRegSIGBLID&)remainder[2];
 
 							// CSR & 0x2000; is the pageflip id.
-							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0);
+							GSvsync((((u32&)RingBuffer.Regs[0x1000]) & 0x2000) ? 0 : 1, remainder[4] != 0, remainder[5] != 0, remainder[6] != 0);
 
 							s_QueuedFrameCount.fetch_sub(1);
 							if (s_VsyncSignalListener.exchange(false))
@@ -524,7 +532,8 @@ void MTGS::MainLoop()
 						{
 							MTGS::FreezeData* data = (MTGS::FreezeData*)tag.pointer;
 							int mode = tag.data[0];
-							data->retval = GSfreeze((FreezeAction)mode, (freezeData*)data->fdata);
+							data->retval = GSfreeze((FreezeAction)mode, (freezeData*)data->fdata,
+								data->incremental ? &data->snapshot_id : nullptr);
 						}
 						break;
 
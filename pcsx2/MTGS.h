@@ -39,6 +39,8 @@ namespace MTGS
 	{
 		freezeData* fdata;
 		s32 retval; // value returned from the call, valid only after an mtgsWaitGS()
+		bool incremental = false; // for reused snapshot buffers, see GSState::Freeze()
+		u64 snapshot_id = 0; // incremental only, the snapshot the buffer holds, and the new one after saving
 	};
 
 	const Threading::ThreadHandle& GetThreadHandle();
@@ -63,7 +65,7 @@ namespace MTGS
 	void Freeze(FreezeAction mode, FreezeData& data);
 
 	int GetCurrentVsyncQueueSize();
-	void PostVsyncStart(bool registers_written);
+	void PostVsyncStart(bool registers_written, bool hidden, bool run_ahead);
 	void InitAndReadFIFO(u8* mem, u32 qwc);
 
 	void RunOnGSThread(AsyncCallType func);
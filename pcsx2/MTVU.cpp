@@ -4,9 +4,12 @@
 #include "Common.h"
 #include "Gif_Unit.h"
 #include "MTVU.h"
+#include "Tracing.h"
 #include "VMManager.h"
 #include "Vif_Dynarec.h"
 
+#include "common/Timer.h"
+
 #include <thread>
 
 VU_Thread vu1Thread;
@@ -116,6 +119,7 @@ void VU_Thread::Reset()
 	vuCycleIdx = 0;
 	m_ato_write_pos = 0;
 	m_write_pos = 0;
+	m_kick_pending = 0;
 	m_ato_read_pos = 0;
 	m_read_pos = 0;
 	std::memset(&vif, 0, sizeof(vif));
@@ -128,6 +132,7 @@ void VU_Thread::Reset()
 void VU_Thread::ExecuteRingBuffer()
 {
 	Threading::SetNameOfCurrentThread("MTVU");
+	Tracing::SetThreadName("MTVU");
 
 	for (;;)
 	{
@@ -135,6 +140,7 @@ void VU_Thread::ExecuteRingBuffer()
 		if (m_shutdown_flag.load(std::memory_order_acquire))
 			break;
 
+		TRACE_ZONE("VU1 Ring");
 		while (m_ato_read_pos.load(std::memory_order_relaxed) != GetWritePos())
 		{
 			u32 tag = Read();
@@ -211,6 +217,7 @@ void VU_Thread::ExecuteRingBuffer()
 // Should only be called by ReserveSpace()
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
+	Common::Timer::Value start = 0;
 	for (;;)
 	{
 		s32 readPos = GetReadPos();
@@ -223,6 +230,8 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 		// Note: a wait lock instead of a yield also helps to avoid the bug.
 		if (readPos > m_write_pos + size + _4kb)
 			break; // Enough free front space
+		if (!start)
+			start = Common::Timer::GetCurrentValue();
 		{          // Let MTVU run to free up buffer space
 			KickStart();
 			// Locking might trigger a full flush of the ring buffer. Yield
@@ -232,6 +241,12 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 			std::this_thread::yield();
 		}
 	}
+
+	if (start)
+	{
+		waitCount[WaitReasonRingFull].fetch_add(1, std::memory_order_relaxed);
+		waitTicks[WaitReasonRingFull].fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
+	}
 }
 
 // Makes sure theres enough room in the ring buffer
@@ -424,9 +439,23 @@ void VU_Thread::Get_MTVUChanges()
 
 void VU_Thread::KickStart()
 {
+	m_kick_pending = 0;
 	semaEvent.NotifyOfWork();
 }
 
+void VU_Thread::KickPending()
+{
+	if (m_kick_pending)
+		KickStart();
+}
+
+__fi void VU_Thread::KickBatched(s32 size)
+{
+	m_kick_pending += size;
+	if (m_kick_pending >= kick_batch_size)
+		KickStart();
+}
+
 bool VU_Thread::IsDone()
 {
 	return GetReadPos() == GetWritePos();
@@ -435,7 +464,20 @@ bool VU_Thread::IsDone()
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
+	// Committed work may still be waiting for its batched kick, and
+	// WaitForEmpty() returns straight away if MTVU is asleep.
+	KickPending();
+
+	if (IsDone())
+	{
+		semaEvent.WaitForEmpty();
+		return;
+	}
+
+	const Common::Timer::Value start = Common::Timer::GetCurrentValue();
 	semaEvent.WaitForEmpty();
+	waitCount[WaitReasonSync].fetch_add(1, std::memory_order_relaxed);
+	waitTicks[WaitReasonSync].fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
 }
 
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst)
@@ -450,6 +492,7 @@ void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst)
 	Write(fbrst);
 	CommitWritePos();
 	gifUnit.TransferGSPacketData(GIF_TRANS_MTVU, NULL, 0);
+	// MTGS waits on XGKICKs from this program as soon as it sees the packet above, so it can't be batched.
 	KickStart();
 	u32 cycles = std::max(Get_vuCycles(), 4u);
 	u32 skip_cycles = std::min(cycles, 3000u);
@@ -468,76 +511,83 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, const u8* dat
 {
 	MTVU_LOG("MTVU - VifUnpack!");
 	u32 vif_copy_size = (u32)((uptr)&_vif.StructEnd - (uptr)&_vif.tag);
-	ReserveSpace(1 + size_u32(vif_copy_size) + size_u32(sizeof(VIFregistersMTVU)) + 1 + size_u32(size));
+	const s32 packet_size = 1 + size_u32(vif_copy_size) + size_u32(sizeof(VIFregistersMTVU)) + 1 + size_u32(size);
+	ReserveSpace(packet_size);
 	Write(MTVU_VIF_UNPACK);
 	Write(&_vif.tag, vif_copy_size);
 	WriteRegs(&_vifRegs);
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteMicroMem(u32 vu_micro_addr, const void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteMicroMem!");
-	ReserveSpace(3 + size_u32(size));
+	const s32 packet_size = 3 + size_u32(size);
+	ReserveSpace(packet_size);
 	Write(MTVU_VU_WRITE_MICRO);
 	Write(vu_micro_addr);
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteDataMem(u32 vu_data_addr, const void* data, u32 size)
 {
 	MTVU_LOG("MTVU - WriteDataMem!");
-	ReserveSpace(3 + size_u32(size));
+	const s32 packet_size = 3 + size_u32(size);
+	ReserveSpace(packet_size);
 	Write(MTVU_VU_WRITE_DATA);
 	Write(vu_data_addr);
 	Write(size);
 	Write(data, size);
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteVIRegs(REG_VI* viRegs)
 {
 	MTVU_LOG("MTVU - WriteRegs!");
-	ReserveSpace(1 + size_u32(32));
+	const s32 packet_size = 1 + size_u32(32);
+	ReserveSpace(packet_size);
 	Write(MTVU_VU_WRITE_VIREGS);
 	Write(viRegs, size_u32(32));
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteVFRegs(VECTOR* vfRegs)
 {
 	MTVU_LOG("MTVU - WriteRegs!");
-	ReserveSpace(1 + size_u32(32*4));
+	const s32 packet_size = 1 + size_u32(32*4);
+	ReserveSpace(packet_size);
 	Write(MTVU_VU_WRITE_VFREGS);
 	Write(vfRegs, size_u32(32*4));
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteCol(vifStruct& _vif)
 {
 	MTVU_LOG("MTVU - WriteCol!");
-	ReserveSpace(1 + size_u32(sizeof(_vif.MaskCol)));
+	const s32 packet_size = 1 + size_u32(sizeof(_vif.MaskCol));
+	ReserveSpace(packet_size);
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
 
 void VU_Thread::WriteRow(vifStruct& _vif)
 {
 	MTVU_LOG("MTVU - WriteRow!");
-	ReserveSpace(1 + size_u32(sizeof(_vif.MaskRow)));
+	const s32 packet_size = 1 + size_u32(sizeof(_vif.MaskRow));
+	ReserveSpace(packet_size);
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
 	CommitWritePos();
-	KickStart();
+	KickBatched(packet_size);
 }
@@ -18,6 +18,9 @@
 // - ring-buffer has no complete pending packets when read_pos==write_pos
 class VU_Thread final {
 	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
+	// Amount of queued non-execute work (in u32's) after which we wake MTVU
+	// instead of waiting for the next ExecuteVU()
+	static const s32 kick_batch_size = _64kb / sizeof(s32);
 
 	u32 buffer[buffer_size];
 	// Note: keep atomic on separate cache line to avoid CPU conflict
@@ -25,6 +28,7 @@ class VU_Thread final {
 	alignas(__cachelinesize) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
 	alignas(__cachelinesize) int  m_read_pos; // temporary read pos (local to the VU thread)
 	int  m_write_pos; // temporary write pos (local to the EE thread)
+	s32  m_kick_pending; // u32's committed since the last kick (local to the EE thread)
 	Threading::WorkSema semaEvent;
 	std::atomic_bool m_shutdown_flag{false};
 
@@ -38,6 +42,17 @@ public:
 	u32 vuCycleIdx;  // Used for VU cycle stealing hack
 	u32 vuFBRST;
 
+	enum WaitReason {
+		WaitReasonSync,     // WaitVU(), EE needs the VU thread's state
+		WaitReasonRingFull, // ReserveSpace(), ring buffer has no free space
+		WaitReasonCount
+	};
+
+	// Times the EE thread stalled on MTVU and the total stall time in
+	// Common::Timer ticks, per reason. Only written by the EE thread.
+	std::atomic<u64> waitCount[WaitReasonCount];
+	std::atomic<u64> waitTicks[WaitReasonCount];
+
 	enum InterruptFlag {
 		InterruptFlagFinish = 1 << 0,
 		InterruptFlagSignal = 1 << 1,
@@ -69,6 +84,9 @@ public:
 	// Get MTVU to start processing its packets if it isn't already
 	void KickStart();
 
+	// Wakes MTVU if committed work is still waiting for its batched kick
+	void KickPending();
+
 	// Used for assertions...
 	bool IsDone();
 
@@ -109,6 +127,10 @@ private:
 	void CommitWritePos();
 	void CommitReadPos();
 
+	// Wakes MTVU once enough work has been queued, otherwise leaves the wakeup
+	// to a later batch, WaitVU(), a full ring buffer or the next vsync
+	void KickBatched(s32 size);
+
 	u32 Read();
 	void Read(void* dest, u32 size);
 	void ReadRegs(VIFregisters* dest);
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Common.h"
+#include "MTVU.h"
+#include "MTVU0.h"
+#include "VMManager.h"
+#include "VUmicro.h"
+
+VU0_Thread vu0Thread;
+
+static thread_local bool s_is_vu0_thread = false;
+
+VU0_Thread::~VU0_Thread()
+{
+	Close();
+}
+
+bool VU0_Thread::IsVU0Thread()
+{
+	return s_is_vu0_thread;
+}
+
+void VU0_Thread::Close()
+{
+	if (!IsOpen())
+		return;
+
+	WaitVU();
+	m_state.fetch_or(StateShutdown, std::memory_order_release);
+	m_work.Post();
+	m_thread.Join();
+	m_state.store(0, std::memory_order_release);
+}
+
+void VU0_Thread::ThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("VU0 Thread");
+	s_is_vu0_thread = true;
+
+	for (;;)
+	{
+		m_work.Wait();
+		if (m_state.load(std::memory_order_acquire) & StateShutdown)
+			break;
+
+		// Run VU0 Micro until E-Bit End, like vu0Finish()
+		while (vpuStat & 1)
+			CpuVU0->Execute(0x7fffffff);
+
+		m_state.fetch_and(~StateBusy, std::memory_order_release);
+		m_state.notify_all();
+	}
+}
+
+void VU0_Thread::ExecuteVU()
+{
+	pxAssert(!m_pending);
+
+	if (!IsOpen())
+	{
+		m_thread.SetStackSize(VMManager::EMU_THREAD_STACK_SIZE);
+		m_thread.Start([this]() { ThreadEntryPoint(); });
+	}
+
+	vpuStat = VU0.VI[REG_VPU_STAT].UL & 0xFF;
+	m_pending = true;
+	m_state.store(StateBusy, std::memory_order_release);
+	m_work.Post();
+
+	// Make sure the next event test picks up the results as soon as possible.
+	cpuSetNextEventDelta(4);
+}
+
+// Waits for the worker to go idle, syncing MTVU on its behalf if it asks.
+void VU0_Thread::ServiceAndWait()
+{
+	for (;;)
+	{
+		const u32 state = m_state.load(std::memory_order_acquire);
+		if (!(state & StateBusy))
+			break;
+
+		if (state & StateVU1Sync)
+		{
+			vu1Thread.WaitVU();
+			m_state.fetch_and(~StateVU1Sync, std::memory_order_release);
+			m_state.notify_all();
+			continue;
+		}
+
+		m_state.wait(state, std::memory_order_acquire);
+	}
+}
+
+void VU0_Thread::ApplyChanges()
+{
+	m_pending = false;
+	VU0.VI[REG_VPU_STAT].UL = (VU0.VI[REG_VPU_STAT].UL & ~0xFF) | (vpuStat & 0xFF);
+
+	if (VU0.flags & VUFLAG_INTCINTERRUPT)
+	{
+		VU0.flags &= ~VUFLAG_INTCINTERRUPT;
+		hwIntcIrq(6);
+	}
+}
+
+void VU0_Thread::WaitVU()
+{
+	if (!m_pending)
+		return;
+
+	ServiceAndWait();
+	ApplyChanges();
+}
+
+void VU0_Thread::Poll()
+{
+	if (!m_pending)
+		return;
+
+	const u32 state = m_state.load(std::memory_order_acquire);
+	if (state & StateVU1Sync)
+	{
+		vu1Thread.WaitVU();
+		m_state.fetch_and(~StateVU1Sync, std::memory_order_release);
+		m_state.notify_all();
+	}
+	else if (!(state & StateBusy))
+	{
+		ApplyChanges();
+	}
+}
+
+void VU0_Thread::WaitIdle()
+{
+	if (m_pending)
+		ServiceAndWait();
+}
+
+void VU0_Thread::WaitForVU1()
+{
+	pxAssert(IsVU0Thread());
+
+	u32 state = m_state.fetch_or(StateVU1Sync, std::memory_order_acq_rel) | StateVU1Sync;
+	m_state.notify_all();
+	while (state & StateVU1Sync)
+	{
+		m_state.wait(state, std::memory_order_acquire);
+		state = m_state.load(std::memory_order_acquire);
+	}
+}
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+#include "common/Threading.h"
+
+#include <atomic>
+
+// Runs VU0 micro programs to completion on a worker thread, while the EE carries on.
+// Notes:
+// - This class should only be accessed from the EE thread, unless stated otherwise.
+// - The EE owns VPU_STAT the whole time. While a program is in flight, VU0's
+//   busy/D/T bits are written to vpuStat instead, and copied over by WaitVU()/Poll().
+// - Everything else VU0 owns (registers, micro/data memory, microVU0) must not be
+//   touched by the EE until WaitVU() returns. The COP2 sync paths take care of that.
+class VU0_Thread final {
+	enum StateFlag : u32 {
+		StateBusy     = 1 << 0, // VU0 program is running on the worker
+		StateVU1Sync  = 1 << 1, // Worker is waiting for the EE to sync MTVU
+		StateShutdown = 1 << 2,
+	};
+
+	std::atomic<u32> m_state{0};
+	bool m_pending = false; // Results of the last program haven't been applied yet
+	Threading::KernelSemaphore m_work;
+	Threading::Thread m_thread;
+
+public:
+	u32 vpuStat; // VU0's VPU_STAT bits, only accessed by the worker while busy
+
+	VU0_Thread() = default;
+	~VU0_Thread();
+
+	/// Returns true if the VU0 thread has been started.
+	__fi bool IsOpen() const { return m_thread.Joinable(); }
+
+	/// Returns true if a VU0 program started on the thread hasn't been synced with yet.
+	__fi bool IsPending() const { return m_pending; }
+
+	/// Address of the pending flag, so the EE recompiler can test it inline.
+	__fi const bool* GetPendingPtr() const { return &m_pending; }
+
+	/// Returns true when called from the VU0 thread. Safe from any thread.
+	static bool IsVU0Thread();
+
+	/// Shuts down the VU0 thread if it is currently running.
+	void Close();
+
+	/// Starts the program set up by vu0ExecMicro() on the VU0 thread.
+	void ExecuteVU();
+
+	/// Waits for the program to finish, and applies its VPU_STAT and interrupt changes.
+	void WaitVU();
+
+	/// Applies the results of a finished program without blocking.
+	void Poll();
+
+	/// Waits for the VU0 thread to stop touching microVU0, without applying the results.
+	/// Used by the EE recompiler, which shares microVU0's state for COP2 macro ops.
+	void WaitIdle();
+
+	/// Called by the VU0 thread before a program accesses VU1's registers under MTVU.
+	/// Only the EE can sync MTVU, so this blocks until it does.
+	void WaitForVU1();
+
+private:
+	void ThreadEntryPoint();
+	void ServiceAndWait();
+	void ApplyChanges();
+};
+
+extern VU0_Thread vu0Thread;
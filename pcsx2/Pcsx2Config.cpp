@@ -324,6 +324,7 @@ static constexpr const char* s_speed_hack_names[] = {
 	"instantVU1",
 	"mtvu",
 	"eeCycleRate",
+	"mtvu0",
 };
 
 const char* Pcsx2Config::SpeedhackOptions::GetSpeedHackName(SpeedHack id)
@@ -361,6 +362,9 @@ void Pcsx2Config::SpeedhackOptions::Set(SpeedHack id, int value)
 		case SpeedHack::EECycleRate:
 			EECycleRate = static_cast<int>(std::clamp<int>(value, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE));
 			break;
+		case SpeedHack::MTVU0:
+			vu0Thread = (value != 0);
+			break;
 			jNO_DEFAULT
 	}
 }
@@ -407,6 +411,7 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(vuFlagHack);
 	SettingsWrapBitBool(vuThread);
 	SettingsWrapBitBool(vu1Instant);
+	SettingsWrapBitBool(vu0Thread);
 
 	EECycleRate = std::clamp(EECycleRate, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE);
 	EECycleSkip = std::min(EECycleSkip, MAX_EE_CYCLE_SKIP);
@@ -453,6 +458,9 @@ Pcsx2Config::RecompilerOptions::RecompilerOptions()
 	EnableVU0 = true;
 	EnableVU1 = true;
 	EnableFastmem = true;
+	EnableSubPageSMC = false;
+	EnableVUProgramCache = false;
+	EnableVU1AsyncCompile = false;
 	PauseOnTLBMiss = false;
 
 	// vu and fpu clamping default to standard overflow.
@@ -531,6 +539,9 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 	SettingsWrapBitBool(EnableFastmem);
+	SettingsWrapBitBool(EnableSubPageSMC);
+	SettingsWrapBitBool(EnableVUProgramCache);
+	SettingsWrapBitBool(EnableVU1AsyncCompile);
 	SettingsWrapBitBool(PauseOnTLBMiss);
 
 	SettingsWrapBitBool(vu0Overflow);
@@ -1261,6 +1272,7 @@ void Pcsx2Config::SPU2Options::LoadSave(SettingsWrapper& wrap)
 		SettingsWrapEntry(StandardVolume);
 		SettingsWrapEntry(FastForwardVolume);
 		SettingsWrapEntry(OutputMuted);
+		SettingsWrapEntry(ThreadedOutput);
 		SettingsWrapParsedEnum(Backend, "Backend", &AudioStream::ParseBackendName, &AudioStream::GetBackendName);
 		SettingsWrapParsedEnum(SyncMode, "SyncMode", &ParseSyncMode, &GetSyncModeName);
 		SettingsWrapEntry(DriverName);
@@ -1280,6 +1292,7 @@ bool Pcsx2Config::SPU2Options::operator==(const SPU2Options& right) const
 		   OpEqu(StandardVolume) &&
 		   OpEqu(FastForwardVolume) &&
 		   OpEqu(OutputMuted) &&
+		   OpEqu(ThreadedOutput) &&
 		   OpEqu(Backend) &&
 		   OpEqu(StreamParameters) &&
 		   OpEqu(DriverName) &&
@@ -1720,6 +1733,7 @@ void Pcsx2Config::EmulationSpeedOptions::SanityCheck()
 	NominalScalar = std::clamp(NominalScalar, 0.05f, 10.0f);
 	TurboScalar = std::clamp(TurboScalar, 0.05f, 10.0f);
 	SlomoScalar = std::clamp(SlomoScalar, 0.05f, 10.0f);
+	RunAheadFrames = std::clamp(RunAheadFrames, 0, MAX_RUN_AHEAD_FRAMES);
 }
 
 void Pcsx2Config::EmulationSpeedOptions::LoadSave(SettingsWrapper& wrap)
@@ -1729,6 +1743,8 @@ void Pcsx2Config::EmulationSpeedOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapEntry(NominalScalar);
 	SettingsWrapEntry(TurboScalar);
 	SettingsWrapEntry(SlomoScalar);
+	SettingsWrapBitBool(LatencyReducedPacing);
+	SettingsWrapEntry(RunAheadFrames);
 
 	// This was in the wrong place... but we can't change it without breaking existing configs.
 	//SettingsWrapBitBool(SyncToHostRefreshRate);
@@ -1738,7 +1754,7 @@ void Pcsx2Config::EmulationSpeedOptions::LoadSave(SettingsWrapper& wrap)
 
 bool Pcsx2Config::EmulationSpeedOptions::operator==(const EmulationSpeedOptions& right) const
 {
-	return OpEqu(bitset) && OpEqu(NominalScalar) && OpEqu(TurboScalar) && OpEqu(SlomoScalar);
+	return OpEqu(bitset) && OpEqu(NominalScalar) && OpEqu(TurboScalar) && OpEqu(SlomoScalar) && OpEqu(RunAheadFrames);
 }
 
 bool Pcsx2Config::EmulationSpeedOptions::operator!=(const EmulationSpeedOptions& right) const
@@ -1,9 +1,15 @@
 // SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
 // SPDX-License-Identifier: GPL-3.0+
 
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cerrno>
+#include <iterator>
 #include <vector>
 
+#include "common/Error.h"
+#include "common/FileSystem.h"
 #include "common/Timer.h"
 #include "common/Threading.h"
 
@@ -13,8 +19,11 @@
 #include "GS/GSCapture.h"
 #include "MTGS.h"
 #include "MTVU.h"
+#include "SPU2/spu2.h"
 #include "VMManager.h"
 
+#include "fmt/format.h"
+
 static const float UPDATE_INTERVAL = 0.5f;
 
 static float s_fps = 0.0f;
@@ -54,9 +63,45 @@ static float s_vu_thread_time = 0.0f;
 static float s_capture_thread_usage = 0.0f;
 static float s_capture_thread_time = 0.0f;
 
+static constexpr u32 NUM_MTVU_WAIT_REASONS = static_cast<u32>(PerformanceMetrics::MTVUWaitReason::Count);
+static_assert(NUM_MTVU_WAIT_REASONS == VU_Thread::WaitReasonCount);
+static std::array<u64, NUM_MTVU_WAIT_REASONS> s_last_mtvu_wait_count = {};
+static std::array<u64, NUM_MTVU_WAIT_REASONS> s_last_mtvu_wait_ticks = {};
+static std::array<float, NUM_MTVU_WAIT_REASONS> s_mtvu_wait_count = {};
+static std::array<float, NUM_MTVU_WAIT_REASONS> s_mtvu_wait_time = {};
+
+static u32 s_audio_underruns = 0;
+static u32 s_audio_overruns = 0;
+static float s_audio_latency = 0.0f;
+
 static PerformanceMetrics::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
 
+// Session frame time histogram. Below 128us buckets are 8us wide, above that each power of two is split into 16
+// buckets, so any frame time is recorded to within ~6% while covering up to ~2 seconds in a fixed-size table.
+static constexpr u32 HISTOGRAM_SUB_BUCKET_BITS = 4;
+static constexpr u32 HISTOGRAM_SUB_BUCKETS = 1u << HISTOGRAM_SUB_BUCKET_BITS;
+static constexpr u32 HISTOGRAM_FIRST_OCTAVE_BITS = 7;
+static constexpr u32 HISTOGRAM_OCTAVES = 15;
+static constexpr u32 HISTOGRAM_BUCKETS = HISTOGRAM_OCTAVES * HISTOGRAM_SUB_BUCKETS;
+static std::array<u32, HISTOGRAM_BUCKETS> s_frame_time_histogram = {};
+static u64 s_frame_time_histogram_count = 0;
+static float s_one_percent_low_frame_time = 0.0f;
+static float s_point_one_percent_low_frame_time = 0.0f;
+
+// A frame is a stutter when it takes twice as long as the recent average, and at least this much longer.
+static constexpr float STUTTER_MIN_SPIKE_MS = 4.0f;
+static constexpr float STUTTER_AVERAGE_WEIGHT = 1.0f / 16.0f;
+static constexpr u32 STUTTER_WARMUP_FRAMES = 30;
+static constexpr u32 MAX_STUTTER_LOG_SIZE = 256;
+static std::array<std::atomic<u32>, PerformanceMetrics::NUM_STUTTER_SOURCES> s_stutter_source_counts = {};
+static std::array<u32, PerformanceMetrics::NUM_STUTTER_SOURCES> s_last_stutter_source_counts = {};
+static std::array<u32, PerformanceMetrics::NUM_STUTTER_SOURCES> s_last_frame_stutter_sources = {};
+static std::deque<PerformanceMetrics::StutterEvent> s_stutter_log;
+static u32 s_stutter_count = 0;
+static u32 s_stutter_warmup_frames = 0;
+static float s_stutter_average_frame_time = 0.0f;
+
 struct GSSWThreadStats
 {
 	Threading::ThreadHandle handle;
@@ -70,6 +115,7 @@ static float s_average_gpu_time = 0.0f;
 static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
 static u32 s_presents_since_last_update = 0;
+static std::atomic<float> s_present_wait_time{0.0f};
 
 void PerformanceMetrics::Clear()
 {
@@ -90,14 +136,29 @@ void PerformanceMetrics::Clear()
 	s_vu_thread_time = 0.0f;
 	s_capture_thread_usage = 0.0f;
 	s_capture_thread_time = 0.0f;
+	s_mtvu_wait_count.fill(0.0f);
+	s_mtvu_wait_time.fill(0.0f);
+	s_audio_underruns = 0;
+	s_audio_overruns = 0;
+	s_audio_latency = 0.0f;
 
 	s_average_gpu_time = 0.0f;
+	s_present_wait_time.store(0.0f, std::memory_order_relaxed);
 	s_gpu_usage = 0.0f;
 
 	s_frame_number = 0;
 
 	s_frame_time_history.fill(0.0f);
 	s_frame_time_history_pos = 0;
+
+	s_frame_time_histogram.fill(0);
+	s_frame_time_histogram_count = 0;
+	s_one_percent_low_frame_time = 0.0f;
+	s_point_one_percent_low_frame_time = 0.0f;
+
+	s_stutter_log.clear();
+	s_stutter_count = 0;
+	s_last_frame_stutter_sources.fill(0);
 }
 
 void PerformanceMetrics::Reset()
@@ -116,6 +177,12 @@ void PerformanceMetrics::Reset()
 	s_last_update_time.Reset();
 	s_last_frame_time.Reset();
 
+	// Don't flag the first frames after a pause or state load as stutters.
+	s_stutter_warmup_frames = STUTTER_WARMUP_FRAMES;
+	s_stutter_average_frame_time = 0.0f;
+	for (u32 i = 0; i < NUM_STUTTER_SOURCES; i++)
+		s_last_stutter_source_counts[i] = s_stutter_source_counts[i].load(std::memory_order_relaxed);
+
 	s_last_cpu_time = s_cpu_thread_handle.GetCPUTime();
 	s_last_gs_time = MTGS::GetThreadHandle().GetCPUTime();
 	s_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
@@ -124,6 +191,102 @@ void PerformanceMetrics::Reset()
 
 	for (GSSWThreadStats& stat : s_gs_sw_threads)
 		stat.last_cpu_time = stat.handle.GetCPUTime();
+
+	for (u32 i = 0; i < NUM_MTVU_WAIT_REASONS; i++)
+	{
+		s_last_mtvu_wait_count[i] = vu1Thread.waitCount[i].load(std::memory_order_relaxed);
+		s_last_mtvu_wait_ticks[i] = vu1Thread.waitTicks[i].load(std::memory_order_relaxed);
+	}
+}
+
+static u32 GetHistogramBucket(float frame_time)
+{
+	const u32 us = static_cast<u32>(std::min(std::max(frame_time, 0.0f) * 1000.0f, 2147483647.0f));
+	if (us < (1u << HISTOGRAM_FIRST_OCTAVE_BITS))
+		return us >> (HISTOGRAM_FIRST_OCTAVE_BITS - HISTOGRAM_SUB_BUCKET_BITS);
+
+	const u32 msb = static_cast<u32>(std::bit_width(us)) - 1;
+	const u32 octave = msb - (HISTOGRAM_FIRST_OCTAVE_BITS - 1);
+	if (octave >= HISTOGRAM_OCTAVES)
+		return HISTOGRAM_BUCKETS - 1;
+
+	const u32 sub_bucket = (us >> (msb - HISTOGRAM_SUB_BUCKET_BITS)) & (HISTOGRAM_SUB_BUCKETS - 1);
+	return octave * HISTOGRAM_SUB_BUCKETS + sub_bucket;
+}
+
+/// Returns the middle of a bucket's range, in milliseconds.
+static float GetHistogramBucketValue(u32 bucket)
+{
+	const u32 octave = bucket / HISTOGRAM_SUB_BUCKETS;
+	const u32 sub_bucket = bucket % HISTOGRAM_SUB_BUCKETS;
+	const u32 shift = (octave == 0) ? (HISTOGRAM_FIRST_OCTAVE_BITS - HISTOGRAM_SUB_BUCKET_BITS) :
+									  (octave + HISTOGRAM_FIRST_OCTAVE_BITS - 1 - HISTOGRAM_SUB_BUCKET_BITS);
+	const u64 start = (octave == 0) ? (static_cast<u64>(sub_bucket) << shift) :
+									  (static_cast<u64>(HISTOGRAM_SUB_BUCKETS + sub_bucket) << shift);
+	return static_cast<float>(start + ((1ull << shift) / 2)) / 1000.0f;
+}
+
+/// Returns the frame time which the given fraction of frames were faster than.
+static float GetHistogramPercentile(double fraction)
+{
+	if (s_frame_time_histogram_count == 0)
+		return 0.0f;
+
+	const u64 slow_frames = std::max<u64>(
+		static_cast<u64>(static_cast<double>(s_frame_time_histogram_count) * (1.0 - fraction)), 1);
+	u64 count = 0;
+	for (u32 bucket = HISTOGRAM_BUCKETS; bucket > 0; bucket--)
+	{
+		count += s_frame_time_histogram[bucket - 1];
+		if (count >= slow_frames)
+			return GetHistogramBucketValue(bucket - 1);
+	}
+
+	return GetHistogramBucketValue(0);
+}
+
+static void UpdateStutterDetection(float frame_time)
+{
+	using namespace PerformanceMetrics;
+
+	std::array<u32, NUM_STUTTER_SOURCES> frame_sources;
+	for (u32 i = 0; i < NUM_STUTTER_SOURCES; i++)
+	{
+		const u32 count = s_stutter_source_counts[i].load(std::memory_order_relaxed);
+		frame_sources[i] = count - s_last_stutter_source_counts[i];
+		s_last_stutter_source_counts[i] = count;
+	}
+
+	if (s_stutter_warmup_frames > 0)
+	{
+		s_stutter_warmup_frames--;
+		s_stutter_average_frame_time = (s_stutter_average_frame_time == 0.0f) ?
+										   frame_time :
+										   (s_stutter_average_frame_time + (frame_time - s_stutter_average_frame_time) * STUTTER_AVERAGE_WEIGHT);
+	}
+	else if (frame_time >= s_stutter_average_frame_time * 2.0f &&
+			 (frame_time - s_stutter_average_frame_time) >= STUTTER_MIN_SPIKE_MS)
+	{
+		// Events just before the spiked frame can land in it too, e.g. a compile at the end of the previous frame.
+		StutterEvent ev;
+		ev.frame_number = s_frame_number;
+		ev.frame_time = frame_time;
+		ev.expected_frame_time = s_stutter_average_frame_time;
+		for (u32 i = 0; i < NUM_STUTTER_SOURCES; i++)
+			ev.sources[i] = frame_sources[i] + s_last_frame_stutter_sources[i];
+
+		if (s_stutter_log.size() == MAX_STUTTER_LOG_SIZE)
+			s_stutter_log.pop_front();
+		s_stutter_log.push_back(ev);
+		s_stutter_count++;
+	}
+	else
+	{
+		// Spikes are left out of the average, so a run of them doesn't hide the ones which follow.
+		s_stutter_average_frame_time += (frame_time - s_stutter_average_frame_time) * STUTTER_AVERAGE_WEIGHT;
+	}
+
+	s_last_frame_stutter_sources = frame_sources;
 }
 
 void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_skipping_present)
@@ -136,7 +299,10 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 		s_maximum_frame_time_accumulator = std::max(s_maximum_frame_time_accumulator, frame_time);
 		s_frame_time_history[s_frame_time_history_pos] = frame_time;
 		s_frame_time_history_pos = (s_frame_time_history_pos + 1) % NUM_FRAME_TIME_SAMPLES;
+		s_frame_time_histogram[GetHistogramBucket(frame_time)]++;
+		s_frame_time_histogram_count++;
 		s_unskipped_frames_since_last_update++;
+		UpdateStutterDetection(frame_time);
 	}
 
 	s_frames_since_last_update++;
@@ -158,6 +324,8 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 	s_average_gpu_time = s_accumulated_gpu_time / static_cast<float>(s_unskipped_frames_since_last_update);
 	s_gpu_usage = s_accumulated_gpu_time / (time * 10.0f);
 	s_accumulated_gpu_time = 0.0f;
+	s_one_percent_low_frame_time = GetHistogramPercentile(0.99);
+	s_point_one_percent_low_frame_time = GetHistogramPercentile(0.999);
 
 	// prefer privileged register write based framerate detection, it's less likely to have false positives
 	if (s_gs_privileged_register_writes_since_last_update > 0 && !EmuConfig.Gamefixes.BlitInternalFPSHack)
@@ -221,6 +389,22 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 		thread.time = static_cast<double>(delta) * time_divider;
 	}
 
+	for (u32 i = 0; i < NUM_MTVU_WAIT_REASONS; i++)
+	{
+		const u64 count = vu1Thread.waitCount[i].load(std::memory_order_relaxed);
+		const u64 ticks = vu1Thread.waitTicks[i].load(std::memory_order_relaxed);
+		s_mtvu_wait_count[i] = static_cast<float>(count - s_last_mtvu_wait_count[i]) / static_cast<float>(s_frames_since_last_update);
+		s_mtvu_wait_time[i] = static_cast<float>(Common::Timer::ConvertValueToMilliseconds(ticks - s_last_mtvu_wait_ticks[i]) /
+												 static_cast<double>(s_frames_since_last_update));
+		s_last_mtvu_wait_count[i] = count;
+		s_last_mtvu_wait_ticks[i] = ticks;
+	}
+
+	// The stream belongs to the CPU thread, so only read what the SPU2 publishes.
+	s_audio_underruns = SPU2::GetOutputUnderrunCount();
+	s_audio_overruns = SPU2::GetOutputOverrunCount();
+	s_audio_latency = SPU2::GetOutputLatency();
+
 	s_frames_since_last_update = 0;
 	s_unskipped_frames_since_last_update = 0;
 	s_presents_since_last_update = 0;
@@ -234,6 +418,28 @@ void PerformanceMetrics::OnGPUPresent(float gpu_time)
 	s_presents_since_last_update++;
 }
 
+void PerformanceMetrics::OnPresentWait(float wait_time)
+{
+	s_present_wait_time.store(wait_time, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::RecordStutterSource(StutterSource source)
+{
+	s_stutter_source_counts[static_cast<u32>(source)].fetch_add(1, std::memory_order_relaxed);
+}
+
+const char* PerformanceMetrics::GetStutterSourceName(StutterSource source)
+{
+	static constexpr std::array<const char*, NUM_STUTTER_SOURCES> names = {{
+		"Shader Compile",
+		"Texture Cache Purge",
+		"microVU Compile",
+		"Disc Read",
+		"Save State",
+	}};
+	return names[static_cast<u32>(source)];
+}
+
 void PerformanceMetrics::SetCPUThread(Threading::ThreadHandle thread)
 {
 	s_last_cpu_time = thread ? thread.GetCPUTime() : 0;
@@ -327,6 +533,16 @@ float PerformanceMetrics::GetVUThreadAverageTime()
 	return s_vu_thread_time;
 }
 
+float PerformanceMetrics::GetMTVUWaitCount(MTVUWaitReason reason)
+{
+	return s_mtvu_wait_count[static_cast<u32>(reason)];
+}
+
+float PerformanceMetrics::GetMTVUWaitAverageTime(MTVUWaitReason reason)
+{
+	return s_mtvu_wait_time[static_cast<u32>(reason)];
+}
+
 float PerformanceMetrics::GetCaptureThreadUsage()
 {
 	return s_capture_thread_usage;
@@ -337,6 +553,21 @@ float PerformanceMetrics::GetCaptureThreadAverageTime()
 	return s_capture_thread_time;
 }
 
+u32 PerformanceMetrics::GetAudioUnderrunCount()
+{
+	return s_audio_underruns;
+}
+
+u32 PerformanceMetrics::GetAudioOverrunCount()
+{
+	return s_audio_overruns;
+}
+
+float PerformanceMetrics::GetAudioLatency()
+{
+	return s_audio_latency;
+}
+
 u32 PerformanceMetrics::GetGSSWThreadCount()
 {
 	return static_cast<u32>(s_gs_sw_threads.size());
@@ -362,6 +593,11 @@ float PerformanceMetrics::GetGPUAverageTime()
 	return s_average_gpu_time;
 }
 
+float PerformanceMetrics::GetPresentWaitTime()
+{
+	return s_present_wait_time.load(std::memory_order_relaxed);
+}
+
 const PerformanceMetrics::FrameTimeHistory& PerformanceMetrics::GetFrameTimeHistory()
 {
 	return s_frame_time_history;
@@ -371,3 +607,106 @@ u32 PerformanceMetrics::GetFrameTimeHistoryPos()
 {
 	return s_frame_time_history_pos;
 }
+
+float PerformanceMetrics::GetOnePercentLowFrameTime()
+{
+	return s_one_percent_low_frame_time;
+}
+
+float PerformanceMetrics::GetPointOnePercentLowFrameTime()
+{
+	return s_point_one_percent_low_frame_time;
+}
+
+u32 PerformanceMetrics::GetStutterCount()
+{
+	return s_stutter_count;
+}
+
+const std::deque<PerformanceMetrics::StutterEvent>& PerformanceMetrics::GetStutterLog()
+{
+	return s_stutter_log;
+}
+
+static void AppendJSONString(std::string& out, std::string_view str)
+{
+	out.push_back('"');
+	for (const char ch : str)
+	{
+		if (ch == '"' || ch == '\\')
+		{
+			out.push_back('\\');
+			out.push_back(ch);
+		}
+		else if (static_cast<unsigned char>(ch) < 0x20)
+		{
+			fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(ch));
+		}
+		else
+		{
+			out.push_back(ch);
+		}
+	}
+	out.push_back('"');
+}
+
+bool PerformanceMetrics::WriteReport(const std::string& path, Error* error)
+{
+	std::string out;
+	out.append("{\n\t\"serial\": ");
+	AppendJSONString(out, VMManager::GetDiscSerial());
+	out.append(",\n\t\"title\": ");
+	AppendJSONString(out, VMManager::GetTitle(true));
+	fmt::format_to(std::back_inserter(out),
+		",\n\t\"frames\": {},\n\t\"one_percent_low_ms\": {:.3f},\n\t\"point_one_percent_low_ms\": {:.3f},\n"
+		"\t\"stutter_count\": {},\n",
+		s_frame_time_histogram_count, GetHistogramPercentile(0.99), GetHistogramPercentile(0.999), s_stutter_count);
+
+	// Only non-empty buckets, as [frame time in ms, count] pairs.
+	out.append("\t\"histogram\": [");
+	bool first = true;
+	for (u32 bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+	{
+		if (s_frame_time_histogram[bucket] == 0)
+			continue;
+
+		fmt::format_to(std::back_inserter(out), "{}[{:.3f}, {}]", first ? "" : ", ", GetHistogramBucketValue(bucket),
+			s_frame_time_histogram[bucket]);
+		first = false;
+	}
+	out.append("],\n");
+
+	out.append("\t\"stutters\": [");
+	first = true;
+	for (const StutterEvent& ev : s_stutter_log)
+	{
+		fmt::format_to(std::back_inserter(out), "{}\n\t\t{{\"frame\": {}, \"frame_time_ms\": {:.3f}, \"expected_ms\": {:.3f}, \"sources\": {{",
+			first ? "" : ",", ev.frame_number, ev.frame_time, ev.expected_frame_time);
+		first = false;
+
+		bool first_source = true;
+		for (u32 i = 0; i < NUM_STUTTER_SOURCES; i++)
+		{
+			if (ev.sources[i] == 0)
+				continue;
+
+			fmt::format_to(std::back_inserter(out), "{}\"{}\": {}", first_source ? "" : ", ",
+				GetStutterSourceName(static_cast<StutterSource>(i)), ev.sources[i]);
+			first_source = false;
+		}
+		out.append("}}");
+	}
+	out.append(first ? "]\n}\n" : "\n\t]\n}\n");
+
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	if (std::fwrite(out.data(), out.size(), 1, fp.get()) != 1)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		return false;
+	}
+
+	return true;
+}
@@ -4,8 +4,12 @@
 #pragma once
 
 #include <array>
+#include <deque>
+#include <string>
 #include "common/Threading.h"
 
+class Error;
+
 namespace PerformanceMetrics
 {
 	enum class InternalFPSMethod
@@ -15,14 +19,52 @@ namespace PerformanceMetrics
 		DISPFBBlit
 	};
 
+	/// Reasons the EE thread stalls waiting on the VU1 thread.
+	enum class MTVUWaitReason
+	{
+		Sync,
+		RingFull,
+		Count
+	};
+
+	/// Subsystem events which can hitch a frame. Counted per frame so frame time spikes can be attributed to them.
+	enum class StutterSource
+	{
+		ShaderCompile,
+		TextureCachePurge,
+		MicroVUCompile,
+		DiscRead,
+		SaveState,
+		Count
+	};
+
 	static constexpr u32 NUM_FRAME_TIME_SAMPLES = 150;
 	using FrameTimeHistory = std::array<float, NUM_FRAME_TIME_SAMPLES>;
 
+	static constexpr u32 NUM_STUTTER_SOURCES = static_cast<u32>(StutterSource::Count);
+
+	struct StutterEvent
+	{
+		u64 frame_number;
+		float frame_time;
+		float expected_frame_time;
+
+		/// Events counted in the spiked frame and the one before it.
+		std::array<u32, NUM_STUTTER_SOURCES> sources;
+	};
+
 	void Clear();
 	void Reset();
 	void Update(bool gs_register_write, bool fb_blit, bool is_skipping_present);
 	void OnGPUPresent(float gpu_time);
 
+	/// Records how long the GS thread was blocked presenting the last frame, in milliseconds.
+	void OnPresentWait(float wait_time);
+
+	/// Counts an event which may cause a hitch. Can be called from any thread.
+	void RecordStutterSource(StutterSource source);
+	const char* GetStutterSourceName(StutterSource source);
+
 	/// Sets the EE thread for CPU usage calculations.
 	void SetCPUThread(Threading::ThreadHandle thread);
 
@@ -48,9 +90,18 @@ namespace PerformanceMetrics
 	float GetGSThreadAverageTime();
 	float GetVUThreadUsage();
 	float GetVUThreadAverageTime();
+	/// Average number of EE stalls on MTVU per frame, and the time spent in them in milliseconds per frame.
+	float GetMTVUWaitCount(MTVUWaitReason reason);
+	float GetMTVUWaitAverageTime(MTVUWaitReason reason);
+
 	float GetCaptureThreadUsage();
 	float GetCaptureThreadAverageTime();
 
+	/// Audio output buffer underruns and overruns since the VM started, and the current output latency in milliseconds.
+	u32 GetAudioUnderrunCount();
+	u32 GetAudioOverrunCount();
+	float GetAudioLatency();
+
 	u32 GetGSSWThreadCount();
 	double GetGSSWThreadUsage(u32 index);
 	double GetGSSWThreadAverageTime(u32 index);
@@ -58,6 +109,20 @@ namespace PerformanceMetrics
 	float GetGPUUsage();
 	float GetGPUAverageTime();
 
+	/// Present wait time of the last frame. Can be called from the CPU thread.
+	float GetPresentWaitTime();
+
 	const FrameTimeHistory& GetFrameTimeHistory();
 	u32 GetFrameTimeHistoryPos();
+
+	/// Frame times at the 99th and 99.9th percentile since the VM started, i.e. the 1% and 0.1% lows, in milliseconds.
+	float GetOnePercentLowFrameTime();
+	float GetPointOnePercentLowFrameTime();
+
+	/// Number of frame time spikes since the VM started, and the most recent of them, oldest first.
+	u32 GetStutterCount();
+	const std::deque<StutterEvent>& GetStutterLog();
+
+	/// Writes the session's frame time histogram and stutter log as JSON.
+	bool WriteReport(const std::string& path, Error* error);
 } // namespace PerformanceMetrics
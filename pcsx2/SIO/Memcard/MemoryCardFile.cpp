@@ -14,8 +14,10 @@
 #include "common/Path.h"
 #include "common/StringUtil.h"
 
+#include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstring>
 
 #include "Config.h"
 #include "Host.h"
@@ -36,6 +38,16 @@ static const char* s_folder_mem_card_id_file = "_pcsx2_superblock";
 
 bool FileMcd_Open = false;
 
+// Writes made by frames which run-ahead will roll back. They're kept out of the card, but the game still
+// has to read back what it wrote until the rollback throws them away.
+struct DeferredMcdWrite
+{
+	uint slot;
+	u32 adr;
+	std::vector<u8> data;
+};
+static std::vector<DeferredMcdWrite> s_deferred_writes;
+
 // ECC code ported from mymc
 // https://sourceforge.net/p/mymc-opl/code/ci/master/tree/ps2mc_ecc.py
 // Public domain license
@@ -622,6 +634,12 @@ void FileMcd_EmuClose()
 	FileMcd_Open = false;
 	Mcd::implFolder.Close();
 	Mcd::impl.Close();
+	FileMcd_DiscardDeferredWrites();
+}
+
+void FileMcd_DiscardDeferredWrites()
+{
+	s_deferred_writes.clear();
 }
 
 void FileMcd_CancelEject()
@@ -741,22 +759,74 @@ bool FileMcd_IsPSX(uint port, uint slot)
 	}
 }
 
+static void FileMcd_ApplyDeferredWrites(uint combinedSlot, u8* dest, u32 adr, int size)
+{
+	// Later writes win, same as they would on the card.
+	for (const DeferredMcdWrite& write : s_deferred_writes)
+	{
+		if (write.slot != combinedSlot)
+			continue;
+
+		const u32 start = std::max(adr, write.adr);
+		const u32 end = std::min(adr + static_cast<u32>(size), write.adr + static_cast<u32>(write.data.size()));
+		if (start < end)
+			std::memcpy(dest + (start - adr), write.data.data() + (start - write.adr), end - start);
+	}
+}
+
+static s32 FileMcd_DeferSave(uint port, uint slot, const u8* src, u32 adr, int size)
+{
+	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
+	DeferredMcdWrite write = {combinedSlot, adr, std::vector<u8>(src, src + size)};
+
+	// PS2 file cards can only clear bits, that's what the erase before a write is for.
+	if (EmuConfig.Mcd[combinedSlot].Type == MemoryCardType::File && !Mcd::impl.IsPSX(combinedSlot))
+	{
+		std::vector<u8> current(size);
+		if (!FileMcd_Read(port, slot, current.data(), adr, size))
+			return 0;
+
+		for (int i = 0; i < size; i++)
+			write.data[i] &= current[i];
+	}
+
+	s_deferred_writes.push_back(std::move(write));
+	return 1;
+}
+
+static s32 FileMcd_DeferEraseBlock(uint port, uint slot, u32 adr)
+{
+	s_deferred_writes.push_back({FileMcd_ConvertToSlot(port, slot), adr, std::vector<u8>(MC2_ERASE_SIZE, 0xff)});
+	return 1;
+}
+
 s32 FileMcd_Read(uint port, uint slot, u8* dest, u32 adr, int size)
 {
 	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
+	s32 result;
 	switch (EmuConfig.Mcd[combinedSlot].Type)
 	{
 		case MemoryCardType::File:
-			return Mcd::impl.Read(combinedSlot, dest, adr, size);
+			result = Mcd::impl.Read(combinedSlot, dest, adr, size);
+			break;
 		case MemoryCardType::Folder:
-			return Mcd::implFolder.Read(combinedSlot, dest, adr, size);
+			result = Mcd::implFolder.Read(combinedSlot, dest, adr, size);
+			break;
 		default:
 			return 0;
 	}
+
+	if (!s_deferred_writes.empty())
+		FileMcd_ApplyDeferredWrites(combinedSlot, dest, adr, size);
+
+	return result;
 }
 
 s32 FileMcd_Save(uint port, uint slot, const u8* src, u32 adr, int size)
 {
+	if (VMManager::Internal::IsRunAheadFrame() && FileMcd_IsPresent(port, slot))
+		return FileMcd_DeferSave(port, slot, src, adr, size);
+
 	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
 	switch (EmuConfig.Mcd[combinedSlot].Type)
 	{
@@ -771,6 +841,9 @@ s32 FileMcd_Save(uint port, uint slot, const u8* src, u32 adr, int size)
 
 s32 FileMcd_EraseBlock(uint port, uint slot, u32 adr)
 {
+	if (VMManager::Internal::IsRunAheadFrame() && FileMcd_IsPresent(port, slot))
+		return FileMcd_DeferEraseBlock(port, slot, adr);
+
 	const uint combinedSlot = FileMcd_ConvertToSlot(port, slot);
 	switch (EmuConfig.Mcd[combinedSlot].Type)
 	{
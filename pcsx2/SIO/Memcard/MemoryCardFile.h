@@ -40,6 +40,7 @@ uint FileMcd_ConvertToSlot(uint port, uint slot);
 void FileMcd_SetType();
 void FileMcd_EmuOpen();
 void FileMcd_EmuClose();
+void FileMcd_DiscardDeferredWrites();
 void FileMcd_CancelEject();
 void FileMcd_Reopen(std::string new_serial);
 void FileMcd_Swap();
@@ -5,6 +5,7 @@
 #include "Host.h"
 #include "IopDma.h"
 #include "Recording/InputRecording.h"
+#include "SaveState.h"
 #include "SIO/Memcard/MemoryCardProtocol.h"
 #include "SIO/Multitap/MultitapProtocol.h"
 #include "SIO/Pad/Pad.h"
@@ -518,6 +519,7 @@ bool Sio2::DoState(StateWrapper& sw)
 
 	// CRCs for memory cards.
 	// If the memory card hasn't changed when loading state, we can safely skip ejecting it.
+	// Run-ahead keeps the writes made between taking a snapshot and loading it off the card, so skip it there.
 	u64 mcdCrcs[SIO::PORTS][SIO::SLOTS];
 	if (sw.IsWriting())
 	{
@@ -529,7 +531,7 @@ bool Sio2::DoState(StateWrapper& sw)
 	}
 	sw.DoBytes(mcdCrcs, sizeof(mcdCrcs));
 
-	if (sw.IsReading())
+	if (sw.IsReading() && !SaveState_IsLoadingSnapshot())
 	{
 		bool ejected = false;
 		for (u32 port = 0; port < SIO::PORTS && !ejected; port++)
@@ -7,6 +7,8 @@
 #include "SPU2/spu2.h"
 #include "SPU2/interpolate_table.h"
 
+#include "GS/GSVector.h"
+
 #include "common/Assertions.h"
 
 // LOOP/END sets the ENDX bit and sets NAX to LSA, and the voice is muted if LOOP is not set
@@ -368,7 +370,9 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 }
 
 
-static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
+// Returns the voice output with ADSR applied, or zero if the voice is stopped.
+// Stereo volume and the output gates are applied by MixCoreVoices().
+static __forceinline s32 MixVoice(uint coreidx, uint voiceidx)
 {
 	V_Core& thiscore(Cores[coreidx]);
 	V_Voice& vc(thiscore.Voices[voiceidx]);
@@ -381,7 +385,6 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 	DecodeSamples(coreidx, voiceidx);
 
-	StereoOut32 voiceOut(0, 0);
 	s32 Value = 0;
 
 	if (vc.ADSR.Phase > V_ADSR::PHASE_STOPPED)
@@ -399,8 +402,6 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
 		if (IsDevBuild)
 			DebugCores[coreidx].Voices[voiceidx].displayPeak = std::max(DebugCores[coreidx].Voices[voiceidx].displayPeak, (s32)vc.OutX);
-
-		voiceOut = ApplyVolume(StereoOut32(Value, Value), vc.Volume);
 	}
 
 	// SPU2 Note: The spu2 continues to process voices for eternity, always, so we
@@ -417,24 +418,50 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 	else if (voiceidx == 3)
 		spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, Value);
 
-	return voiceOut;
+	return Value;
 }
 
 static __forceinline void MixCoreVoices(VoiceMixSet& dest, const uint coreidx)
 {
+	static_assert(V_Core::NumVoices % 4 == 0);
+
 	V_Core& thiscore(Cores[coreidx]);
 
+	// Voices have to be stepped in order (pitch modulation reads the previous voice's
+	// output), but volume and gating are independent per voice, so do those in bulk.
+	alignas(16) s32 values[V_Core::NumVoices];
+	alignas(16) s32 volumeL[V_Core::NumVoices];
+	alignas(16) s32 volumeR[V_Core::NumVoices];
+
 	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
 	{
-		StereoOut32 VVal(MixVoice(coreidx, voiceidx));
-
-		// Note: Results from MixVoice are ranged at 16 bits.
+		values[voiceidx] = MixVoice(coreidx, voiceidx);
+		volumeL[voiceidx] = thiscore.Voices[voiceidx].Volume.Left.Value;
+		volumeR[voiceidx] = thiscore.Voices[voiceidx].Volume.Right.Value;
+	}
 
-		dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-		dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-		dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-		dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+	// Lanes are Dry.Left, Dry.Right, Wet.Left, Wet.Right, the same as V_VoiceGates.
+	GSVector4i mix = GSVector4i::zero();
+	for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; voiceidx += 4)
+	{
+		const GSVector4i value = GSVector4i::load<true>(&values[voiceidx]);
+		const GSVector4i left = value.mul32l(GSVector4i::load<true>(&volumeL[voiceidx])).sra32<15>();
+		const GSVector4i right = value.mul32l(GSVector4i::load<true>(&volumeR[voiceidx])).sra32<15>();
+
+		// Note: Results are ranged at 16 bits.
+		const GSVector4i lr01 = left.upl32(right);
+		const GSVector4i lr23 = left.uph32(right);
+		const V_VoiceGates* gates = &thiscore.VoiceGates[voiceidx];
+		mix += lr01.upl64(lr01) & GSVector4i::load<false>(&gates[0]);
+		mix += lr01.uph64(lr01) & GSVector4i::load<false>(&gates[1]);
+		mix += lr23.upl64(lr23) & GSVector4i::load<false>(&gates[2]);
+		mix += lr23.uph64(lr23) & GSVector4i::load<false>(&gates[3]);
 	}
+
+	dest.Dry.Left += mix.extract32<0>();
+	dest.Dry.Right += mix.extract32<1>();
+	dest.Wet.Left += mix.extract32<2>();
+	dest.Wet.Right += mix.extract32<3>();
 }
 
 static __forceinline StereoOut32 MixCore(const uint coreidx, const VoiceMixSet& inVoices, const StereoOut32& Input, const StereoOut32& Ext)
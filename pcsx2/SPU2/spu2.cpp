@@ -10,9 +10,13 @@
 #include "GS/GSCapture.h"
 #include "MTGS.h"
 #include "R3000A.h"
+#include "Tracing.h"
 #include "VMManager.h"
 
 #include "common/Error.h"
+#include "common/Threading.h"
+
+#include <atomic>
 
 const StereoOut32 StereoOut32::Empty(0, 0);
 
@@ -22,6 +26,14 @@ namespace SPU2
 	static void UpdateSampleRate();
 	static float GetNominalRate();
 	static void InternalReset(bool psxmode);
+
+	static void StartOutputThread();
+	static void StopOutputThread();
+	static void SyncOutputThread();
+	static void OutputThreadEntryPoint();
+
+	static void PublishOutputStats();
+	static void DestroyOutputStream();
 } // namespace SPU2
 
 u64 lClocks = 0;
@@ -29,6 +41,7 @@ u64 lClocks = 0;
 static bool s_audio_capture_active = false;
 static bool s_psxmode = false;
 static bool s_output_muted = false;
+static bool s_output_discarded = false;
 
 static std::unique_ptr<AudioStream> s_output_stream;
 static std::array<float, AudioStream::CHUNK_SIZE * 2> s_current_chunk;
@@ -36,6 +49,27 @@ static u32 s_current_chunk_pos;
 static u32 s_standard_volume = 0;
 static u32 s_fast_forward_volume = 0;
 
+// Optional worker which runs the output stream's expansion and time stretching, so the
+// IOP thread only has to mix. Mixing itself stays in lockstep with the IOP, as voices
+// raise IRQs and set ENDX while they read sound memory.
+// The IOP thread fills the queue, the worker drains it. Anything else which touches the
+// stream's write side has to call SyncOutputThread() first.
+static constexpr u32 OUTPUT_QUEUE_CHUNKS = 64; // ~85ms at 48KHz
+static Threading::Thread s_output_thread;
+static Threading::WorkSema s_output_sema;
+static std::array<std::array<float, AudioStream::CHUNK_SIZE * 2>, OUTPUT_QUEUE_CHUNKS> s_output_queue;
+static std::atomic<u32> s_output_queue_rpos{0};
+static std::atomic<u32> s_output_queue_wpos{0};
+static std::atomic_bool s_output_thread_shutdown{false};
+
+// Output stats for other threads (PerformanceMetrics reads them on the GS thread), published by
+// the IOP thread. Counts carry on across stream recreates, so they're kept since SPU2 was opened.
+static u32 s_closed_stream_underruns = 0;
+static u32 s_closed_stream_overruns = 0;
+static std::atomic<u32> s_output_underruns{0};
+static std::atomic<u32> s_output_overruns{0};
+static std::atomic<float> s_output_latency{0.0f};
+
 float DCFilterIn[2], DCFilterOut[2];
 
 u32 SPU2::GetConsoleSampleRate()
@@ -100,8 +134,65 @@ void SPU2writeDMA7Mem(u16* pMem, u32 size)
 	Cores[1].DoDMAwrite(pMem, size);
 }
 
+void SPU2::StartOutputThread()
+{
+	if (s_output_thread.Joinable())
+		return;
+
+	s_output_queue_rpos.store(0, std::memory_order_relaxed);
+	s_output_queue_wpos.store(0, std::memory_order_relaxed);
+	s_output_thread_shutdown.store(false, std::memory_order_relaxed);
+	s_output_sema.Reset();
+	s_output_thread.Start(&SPU2::OutputThreadEntryPoint);
+}
+
+void SPU2::StopOutputThread()
+{
+	if (!s_output_thread.Joinable())
+		return;
+
+	// Let it drain what's left, so a stream recreate doesn't drop the tail.
+	SyncOutputThread();
+	s_output_thread_shutdown.store(true, std::memory_order_release);
+	s_output_sema.NotifyOfWork();
+	s_output_thread.Join();
+}
+
+void SPU2::SyncOutputThread()
+{
+	if (s_output_thread.Joinable())
+		s_output_sema.WaitForEmpty();
+}
+
+void SPU2::OutputThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("SPU2 Output");
+	Tracing::SetThreadName("SPU2 Output");
+
+	for (;;)
+	{
+		s_output_sema.WaitForWork();
+		if (s_output_thread_shutdown.load(std::memory_order_acquire))
+			break;
+
+		TRACE_ZONE("SPU2 Output");
+		u32 rpos = s_output_queue_rpos.load(std::memory_order_relaxed);
+		const u32 wpos = s_output_queue_wpos.load(std::memory_order_acquire);
+		while (rpos != wpos)
+		{
+			s_output_stream->WriteChunk(s_output_queue[rpos].data());
+			rpos = (rpos + 1) % OUTPUT_QUEUE_CHUNKS;
+			s_output_queue_rpos.store(rpos, std::memory_order_release);
+		}
+	}
+
+	s_output_sema.Kill();
+}
+
 void SPU2::CreateOutputStream()
 {
+	StopOutputThread();
+
 	// Initialize volume and mute settings on new session.
 	if (!s_output_stream)
 	{
@@ -114,7 +205,7 @@ void SPU2::CreateOutputStream()
 		SPU2::SaveOutputVolume();
 
 	const u32 sample_rate = GetConsoleSampleRate();
-	s_output_stream.reset();
+	DestroyOutputStream();
 
 	Error error;
 	s_output_stream = AudioStream::CreateStream(EmuConfig.SPU2.Backend, sample_rate, EmuConfig.SPU2.StreamParameters,
@@ -131,6 +222,28 @@ void SPU2::CreateOutputStream()
 	SPU2::UpdateOutputVolume();
 	s_output_stream->SetNominalRate(GetNominalRate());
 	s_output_stream->SetPaused(VMManager::GetState() == VMState::Paused);
+
+	if (EmuConfig.SPU2.ThreadedOutput)
+		StartOutputThread();
+}
+
+void SPU2::DestroyOutputStream()
+{
+	if (!s_output_stream)
+		return;
+
+	PublishOutputStats();
+	s_closed_stream_underruns += s_output_stream->GetUnderrunCount();
+	s_closed_stream_overruns += s_output_stream->GetOverrunCount();
+	s_output_stream.reset();
+	s_output_latency.store(0.0f, std::memory_order_relaxed);
+}
+
+void SPU2::PublishOutputStats()
+{
+	s_output_underruns.store(s_closed_stream_underruns + s_output_stream->GetUnderrunCount(), std::memory_order_relaxed);
+	s_output_overruns.store(s_closed_stream_overruns + s_output_stream->GetOverrunCount(), std::memory_order_relaxed);
+	s_output_latency.store(s_output_stream->GetLatencyMS(), std::memory_order_relaxed);
 }
 
 void SPU2::UpdateSampleRate()
@@ -148,6 +261,21 @@ void SPU2::UpdateSampleRate()
 	}
 }
 
+u32 SPU2::GetOutputUnderrunCount()
+{
+	return s_output_underruns.load(std::memory_order_relaxed);
+}
+
+u32 SPU2::GetOutputOverrunCount()
+{
+	return s_output_overruns.load(std::memory_order_relaxed);
+}
+
+float SPU2::GetOutputLatency()
+{
+	return s_output_latency.load(std::memory_order_relaxed);
+}
+
 u32 SPU2::GetOutputVolume()
 {
 	return s_output_stream->GetOutputVolume();
@@ -206,6 +334,7 @@ void SPU2::SaveOutputVolume()
 
 void SPU2::SetOutputPaused(bool paused)
 {
+	SyncOutputThread();
 	s_output_stream->SetPaused(paused);
 }
 
@@ -219,6 +348,11 @@ bool SPU2::IsAudioCaptureActive()
 	return s_audio_capture_active;
 }
 
+void SPU2::SetOutputDiscarded(bool discarded)
+{
+	s_output_discarded = discarded;
+}
+
 void SPU2::InternalReset(bool psxmode)
 {
 	spu2Mix = MULTI_ISA_SELECT(spu2Mix);
@@ -255,6 +389,8 @@ void SPU2::OnTargetSpeedChanged()
 	if (!s_output_stream)
 		return;
 
+	SyncOutputThread();
+
 	if (!s_output_stream->IsStretchEnabled())
 	{
 		s_output_stream->EmptyBuffer();
@@ -296,6 +432,10 @@ bool SPU2::Open()
 
 	InternalReset(false);
 
+	s_closed_stream_underruns = 0;
+	s_closed_stream_overruns = 0;
+	s_output_underruns.store(0, std::memory_order_relaxed);
+	s_output_overruns.store(0, std::memory_order_relaxed);
 	CreateOutputStream();
 #ifdef PCSX2_DEVBUILD
 	WaveDump::Open();
@@ -308,7 +448,8 @@ void SPU2::Close()
 {
 	FileLog("[%10d] SPU2 Close\n", Cycles);
 
-	s_output_stream.reset();
+	StopOutputThread();
+	DestroyOutputStream();
 
 #ifdef PCSX2_DEVBUILD
 	WaveDump::Close();
@@ -357,9 +498,21 @@ void SPU2::CheckForConfigChanges(const Pcsx2Config& old_config)
 	{
 		CreateOutputStream();
 	}
-	else if (opts.IsTimeStretchEnabled() != old_opts.IsTimeStretchEnabled())
+	else
 	{
-		s_output_stream->SetStretchEnabled(opts.IsTimeStretchEnabled());
+		if (opts.IsTimeStretchEnabled() != old_opts.IsTimeStretchEnabled())
+		{
+			SyncOutputThread();
+			s_output_stream->SetStretchEnabled(opts.IsTimeStretchEnabled());
+		}
+
+		if (opts.ThreadedOutput != old_opts.ThreadedOutput)
+		{
+			if (opts.ThreadedOutput)
+				StartOutputThread();
+			else
+				StopOutputThread();
+		}
 	}
 
 #ifdef PCSX2_DEVBUILD
@@ -508,6 +661,10 @@ static void DCFilter(float *input)
 
 __forceinline void spu2Output(StereoOut32 out)
 {
+	// Skip the filter as well, so the samples we do keep carry on from the last ones played.
+	if (s_output_discarded) [[unlikely]]
+		return;
+
 	float conv[2];
 
 	conv[0] = static_cast<float>(clamp_mix(out.Left)) / INT16_MAX;
@@ -523,7 +680,25 @@ __forceinline void spu2Output(StereoOut32 out)
 	{
 		s_current_chunk_pos = 0;
 
-		s_output_stream->WriteChunk(s_current_chunk.data());
+		if (s_output_thread.Joinable())
+		{
+			const u32 wpos = s_output_queue_wpos.load(std::memory_order_relaxed);
+			const u32 next_wpos = (wpos + 1) % OUTPUT_QUEUE_CHUNKS;
+
+			// Worker has fallen behind, block rather than dropping audio.
+			if (next_wpos == s_output_queue_rpos.load(std::memory_order_acquire)) [[unlikely]]
+				s_output_sema.WaitForEmpty();
+
+			s_output_queue[wpos] = s_current_chunk;
+			s_output_queue_wpos.store(next_wpos, std::memory_order_release);
+			s_output_sema.NotifyOfWork();
+		}
+		else
+		{
+			s_output_stream->WriteChunk(s_current_chunk.data());
+		}
+
+		SPU2::PublishOutputStats();
 
 		if (SPU2::IsAudioCaptureActive()) [[unlikely]]
 			GSCapture::DeliverAudioPacket(s_current_chunk.data());
@@ -60,9 +60,18 @@ bool IsRunningPSXMode();
 /// Returns the current sample rate the SPU2 is operating at.
 u32 GetConsoleSampleRate();
 
+/// Output buffer underruns and overruns since the SPU2 was opened, and the current output latency in milliseconds.
+/// Published by the IOP thread as chunks are queued, safe to call from any thread.
+u32 GetOutputUnderrunCount();
+u32 GetOutputOverrunCount();
+float GetOutputLatency();
+
 /// Tells SPU2 to forward audio packets to GSCapture.
 void SetAudioCaptureActive(bool active);
 bool IsAudioCaptureActive();
+
+/// Drops mixed output instead of playing it, for frames which are going to be rolled back.
+void SetOutputDiscarded(bool discarded);
 } // namespace SPU2
 
 void SPU2write(u32 mem, u16 value);
@@ -16,6 +16,7 @@
 #include "Host.h"
 #include "MTGS.h"
 #include "MTVU.h"
+#include "MTVU0.h"
 #include "Patch.h"
 #include "R3000A.h"
 #include "SIO/Multitap/MultitapProtocol.h"
@@ -41,19 +42,48 @@
 #include "IconsFontAwesome.h"
 #include "fmt/format.h"
 
+#include <atomic>
 #include <csetjmp>
 #include <png.h>
+#include <span>
+#include <thread>
 
 using namespace R5900;
 
 static tlbs s_tlb_backup[std::size(tlb)];
+static bool s_loading_snapshot = false;
 
-static void PreLoadPrep()
+static void WaitForVMThreads()
 {
 	// ensure everything is in sync before we start overwriting stuff.
 	if (THREAD_VU1)
 		vu1Thread.WaitVU();
+	vu0Thread.WaitVU();
 	MTGS::WaitGS(false);
+}
+
+static void RemapChangedTLBs()
+{
+	for (int i = 0; i < 48; i++)
+	{
+		if (std::memcmp(&s_tlb_backup[i], &tlb[i], sizeof(tlbs)) != 0)
+		{
+			UnmapTLB(s_tlb_backup[i], i);
+			MapTLB(tlb[i], i);
+		}
+	}
+}
+
+static void WarnIfMTVUEnabled()
+{
+	// Print this until the MTVU problem in gifPathFreeze is taken care of (rama)
+	if (THREAD_VU1)
+		Console.Warning("MTVU speedhack is enabled, saved states may not be stable");
+}
+
+static void PreLoadPrep()
+{
+	WaitForVMThreads();
 
 	// backup current TLBs, since we're going to overwrite them all
 	std::memcpy(s_tlb_backup, tlb, sizeof(s_tlb_backup));
@@ -68,14 +98,7 @@ static void PostLoadPrep()
 {
 	resetCache();
 //	WriteCP0Status(cpuRegs.CP0.n.Status.val);
-	for (int i = 0; i < 48; i++)
-	{
-		if (std::memcmp(&s_tlb_backup[i], &tlb[i], sizeof(tlbs)) != 0)
-		{
-			UnmapTLB(s_tlb_backup[i], i);
-			MapTLB(tlb[i], i);
-		}
-	}
+	RemapChangedTLBs();
 
 	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
 	CBreakPoints::SetSkipFirst(BREAKPOINT_EE, 0);
@@ -87,6 +110,41 @@ static void PostLoadPrep()
 		R5900SymbolImporter.OnElfLoadedInMemory();
 }
 
+// Snapshot loads keep the recompilers and block tracking. Memory entries only write the pages which
+// changed, and invalidate whatever was compiled from them as they go.
+static void PreSnapshotLoadPrep()
+{
+	WaitForVMThreads();
+	std::memcpy(s_tlb_backup, tlb, sizeof(s_tlb_backup));
+}
+
+static void PostSnapshotLoadPrep()
+{
+	resetCache();
+	RemapChangedTLBs();
+
+	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
+
+	// Same VM, so the rate can only have changed if the video mode did.
+	UpdateVSyncRate(false);
+}
+
+/// Copies the pages of src which differ from dst, calling on_copy(offset, size) for each. Most of memory is
+/// untouched between snapshots, and comparing is far cheaper than writing, especially into a code page.
+template <typename T>
+static void CopyChangedPages(u8* dst, const u8* src, u32 size, const T& on_copy)
+{
+	for (u32 offset = 0; offset < size; offset += __pagesize)
+	{
+		const u32 page_size = std::min<u32>(__pagesize, size - offset);
+		if (std::memcmp(dst + offset, src + offset, page_size) == 0)
+			continue;
+
+		std::memcpy(dst + offset, src + offset, page_size);
+		on_copy(offset, page_size);
+	}
+}
+
 // --------------------------------------------------------------------------------------
 //  SaveStateBase  (implementations)
 // --------------------------------------------------------------------------------------
@@ -172,9 +230,9 @@ bool SaveStateBase::FreezeBios()
 
 bool SaveStateBase::FreezeInternals(Error* error)
 {
-	// Print this until the MTVU problem in gifPathFreeze is taken care of (rama)
-	if (THREAD_VU1)
-		Console.Warning("MTVU speedhack is enabled, saved states may not be stable");
+	// A program finishing on the VU0 thread can still raise an interrupt, get that in first.
+	if (IsSaving())
+		vu0Thread.WaitVU();
 
 	if (!vmFreeze())
 		return false;
@@ -354,12 +412,36 @@ static int SysState_MTGSFreeze(FreezeAction mode, freezeData* fP)
 	return sstate.retval;
 }
 
+// Where the last snapshot put the GS block, and which GS snapshot it holds. Entries before it can change size,
+// so the GS can only copy what it's written since when the block is in the same place again.
+static const u8* s_gs_snapshot_data = nullptr;
+static u64 s_gs_snapshot_id = 0;
+
+static int SysState_MTGSSnapshot(FreezeAction mode, freezeData* fP)
+{
+	// Snapshot buffers are reused, so the GS only has to copy the parts of local memory which were written.
+	MTGS::FreezeData sstate = { fP, 0, true };
+	if (mode != FreezeAction::Size && fP->data == s_gs_snapshot_data)
+		sstate.snapshot_id = s_gs_snapshot_id;
+
+	MTGS::Freeze(mode, sstate);
+
+	if (mode == FreezeAction::Save)
+	{
+		s_gs_snapshot_data = (sstate.retval == 0) ? fP->data : nullptr;
+		s_gs_snapshot_id = sstate.snapshot_id;
+	}
+
+	return sstate.retval;
+}
+
 static constexpr SysState_Component SPU2_{ "SPU2", SPU2freeze };
 static constexpr SysState_Component GS{ "GS", SysState_MTGSFreeze };
+static constexpr SysState_Component GSSnapshot{ "GS", SysState_MTGSSnapshot };
 
-static bool SysState_ComponentFreezeIn(zip_file_t* zf, SysState_Component comp)
+static bool SysState_ComponentFreezeIn(const std::vector<u8>* data, SysState_Component comp)
 {
-	if (!zf)
+	if (!data)
 		return true;
 
 	freezeData fP = { 0, nullptr };
@@ -368,17 +450,15 @@ static bool SysState_ComponentFreezeIn(zip_file_t* zf, SysState_Component comp)
 
 	Console.WriteLn("  Loading %s", comp.name);
 
-	std::unique_ptr<u8[]> data;
 	if (fP.size > 0)
 	{
-		data = std::make_unique<u8[]>(fP.size);
-		fP.data = data.get();
-
-		if (zip_fread(zf, data.get(), fP.size) != static_cast<zip_int64_t>(fP.size))
+		if (data->size() < static_cast<size_t>(fP.size))
 		{
 			Console.Error(fmt::format("* {}: Failed to decompress save data", comp.name));
 			return false;
 		}
+
+		fP.data = const_cast<u8*>(data->data());
 	}
 
 	if (comp.freeze(FreezeAction::Load, &fP) != 0)
@@ -418,18 +498,34 @@ static bool SysState_ComponentFreezeOut(SaveStateBase& writer, SysState_Componen
 	return true;
 }
 
-static bool SysState_ComponentFreezeInNew(zip_file_t* zf, const char* name, bool(*do_state_func)(StateWrapper&))
+static bool SysState_ComponentSnapshotIn(std::span<const u8> data, SysState_Component comp)
 {
-	// TODO: We could decompress on the fly here for a little bit more speed.
-	std::vector<u8> data;
-	if (zf)
-	{
-		std::optional<std::vector<u8>> optdata(ReadBinaryFileInZip(zf));
-		if (optdata.has_value())
-			data = std::move(optdata.value());
-	}
+	freezeData fP = {static_cast<int>(data.size()), const_cast<u8*>(data.data())};
+	return (comp.freeze(FreezeAction::Load, &fP) == 0);
+}
 
-	StateWrapper::ReadOnlyMemoryStream stream(data.empty() ? nullptr : data.data(), data.size());
+static bool SysState_ComponentSnapshotOut(SaveStateBase& writer, SysState_Component comp)
+{
+	freezeData fP = {};
+	if (comp.freeze(FreezeAction::Size, &fP) != 0)
+		return false;
+
+	writer.PrepBlock(fP.size);
+	if (!writer.IsOkay())
+		return false;
+
+	fP.data = writer.GetBlockPtr();
+	if (comp.freeze(FreezeAction::Save, &fP) != 0)
+		return false;
+
+	writer.CommitBlock(fP.size);
+	return true;
+}
+
+static bool SysState_ComponentFreezeInNew(const std::vector<u8>* data, const char* name, bool(*do_state_func)(StateWrapper&))
+{
+	const size_t size = data ? data->size() : 0;
+	StateWrapper::ReadOnlyMemoryStream stream(size > 0 ? data->data() : nullptr, size);
 	StateWrapper sw(&stream, StateWrapper::Mode::Read, g_SaveVersion);
 
 	return do_state_func(sw);
@@ -454,6 +550,29 @@ static bool SysState_ComponentFreezeOutNew(SaveStateBase& writer, const char* na
 	return true;
 }
 
+static bool ReadEntryInZip(zip_t* zf, zip_int64_t index, std::vector<u8>* data)
+{
+	zip_stat_t zst;
+	if (zip_stat_index(zf, index, 0, &zst) != 0 || zst.size > std::numeric_limits<int>::max())
+		return false;
+
+	auto zff = zip_fopen_index_managed(zf, index, 0);
+	if (!zff)
+		return false;
+
+	// Sized from the directory up front, so it's decompressed once into its final buffer.
+	data->resize(zst.size);
+	return (zip_fread(zff.get(), data->data(), data->size()) == static_cast<zip_int64_t>(data->size()));
+}
+
+static bool SysState_ComponentSnapshotInNew(std::span<const u8> data, bool (*do_state_func)(StateWrapper&))
+{
+	StateWrapper::ReadOnlyMemoryStream stream(data.empty() ? nullptr : data.data(), data.size());
+	StateWrapper sw(&stream, StateWrapper::Mode::Read, g_SaveVersion);
+
+	return do_state_func(sw);
+}
+
 // --------------------------------------------------------------------------------------
 //  BaseSavestateEntry
 // --------------------------------------------------------------------------------------
@@ -466,9 +585,20 @@ public:
 	virtual ~BaseSavestateEntry() = default;
 
 	virtual const char* GetFilename() const = 0;
-	virtual bool FreezeIn(zip_file_t* zf) const = 0;
 	virtual bool FreezeOut(SaveStateBase& writer) const = 0;
 	virtual bool IsRequired() const = 0;
+
+	// Loading is split so entries can be decompressed in parallel. ReadIn() runs on a worker thread with its
+	// own handle to the archive, then FreezeIn() applies the data on the CPU thread, in order. Data is null
+	// when the entry isn't in the archive.
+	virtual bool ReadIn(zip_t* zf, zip_int64_t index, std::vector<u8>* data) const { return ReadEntryInZip(zf, index, data); }
+	virtual bool FreezeIn(const std::vector<u8>* data) const = 0;
+
+	// In-memory snapshots are only ever loaded back into the VM which made them, so they can skip
+	// anything the archive needs for compatibility, and only touch what has changed.
+	virtual bool SnapshotIn(std::span<const u8> data) const = 0;
+	virtual bool SnapshotOut(SaveStateBase& writer) const { return FreezeOut(writer); }
+	virtual bool IsSnapshotted() const { return true; }
 };
 
 class MemorySavestateEntry : public BaseSavestateEntry
@@ -478,19 +608,31 @@ protected:
 	virtual ~MemorySavestateEntry() = default;
 
 public:
-	virtual bool FreezeIn(zip_file_t* zf) const;
+	bool ReadIn(zip_t* zf, zip_int64_t index, std::vector<u8>* data) const override;
+	bool FreezeIn(const std::vector<u8>* data) const override { return true; }
 	virtual bool FreezeOut(SaveStateBase& writer) const;
 	virtual bool IsRequired() const { return true; }
 
+	bool SnapshotIn(std::span<const u8> data) const override;
+	bool SnapshotOut(SaveStateBase& writer) const override;
+
 protected:
 	virtual u8* GetDataPtr() const = 0;
 	virtual u32 GetDataSize() const = 0;
+
+	// Called for each page a snapshot load overwrote, for throwing away code compiled from it.
+	virtual void OnPageRestored(u32 offset, u32 size) const {}
 };
 
-bool MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
+bool MemorySavestateEntry::ReadIn(zip_t* zf, zip_int64_t index, std::vector<u8>* data) const
 {
+	// Nothing else touches VM memory during a load, so decompress straight into it, and leave FreezeIn() nothing to do.
+	auto zff = zip_fopen_index_managed(zf, index, 0);
+	if (!zff)
+		return false;
+
 	const u32 expectedSize = GetDataSize();
-	const s64 bytesRead = zip_fread(zf, GetDataPtr(), expectedSize);
+	const s64 bytesRead = zip_fread(zff.get(), GetDataPtr(), expectedSize);
 	if (bytesRead != static_cast<s64>(expectedSize))
 	{
 		Console.WriteLn(Color_Yellow, " '%s' is incomplete (expected 0x%x bytes, loading only 0x%x bytes)",
@@ -506,6 +648,29 @@ bool MemorySavestateEntry::FreezeOut(SaveStateBase& writer) const
 	return writer.IsOkay();
 }
 
+bool MemorySavestateEntry::SnapshotIn(std::span<const u8> data) const
+{
+	if (data.size() != GetDataSize())
+		return false;
+
+	CopyChangedPages(GetDataPtr(), data.data(), GetDataSize(),
+		[this](u32 offset, u32 size) { OnPageRestored(offset, size); });
+	return true;
+}
+
+bool MemorySavestateEntry::SnapshotOut(SaveStateBase& writer) const
+{
+	// The buffer is reused from the last snapshot, so whatever hasn't changed since is already there.
+	const u32 size = GetDataSize();
+	writer.PrepBlock(size);
+	if (!writer.IsOkay())
+		return false;
+
+	CopyChangedPages(writer.GetBlockPtr(), GetDataPtr(), size, [](u32, u32) {});
+	writer.CommitBlock(size);
+	return true;
+}
+
 // --------------------------------------------------------------------------------------
 //  SavestateEntry_* (EmotionMemory, IopMemory, etc)
 // --------------------------------------------------------------------------------------
@@ -524,10 +689,8 @@ public:
 	u8* GetDataPtr() const override { return eeMem->Main; }
 	uint GetDataSize() const override { return Ps2MemSize::ExposedRam; }
 
-	virtual bool FreezeIn(zip_file_t* zf) const override
-	{
-		return MemorySavestateEntry::FreezeIn(zf);
-	}
+	// Nothing to do on restore, pages holding recompiled code are write protected, and the
+	// fault clears their blocks the same as it would for a DMA.
 };
 
 class SavestateEntry_IopMemory final : public MemorySavestateEntry
@@ -538,6 +701,7 @@ public:
 	const char* GetFilename() const override { return "iopMemory.bin"; }
 	u8* GetDataPtr() const override { return iopMem->Main; }
 	uint GetDataSize() const override { return Ps2MemSize::ExposedIopRam; }
+	void OnPageRestored(u32 offset, u32 size) const override { psxCpu->Clear(offset, size / 4); }
 };
 
 class SavestateEntry_HwRegs final : public MemorySavestateEntry
@@ -598,6 +762,7 @@ public:
 	const char* GetFilename() const override { return "vu0MicroMem.bin"; }
 	u8* GetDataPtr() const override { return vuRegs[0].Micro; }
 	uint GetDataSize() const override { return VU0_PROGSIZE; }
+	void OnPageRestored(u32 offset, u32 size) const override { CpuVU0->Clear(offset, size); }
 };
 
 class SavestateEntry_VU1prog final : public MemorySavestateEntry
@@ -608,6 +773,7 @@ public:
 	const char* GetFilename() const override { return "vu1MicroMem.bin"; }
 	u8* GetDataPtr() const override { return vuRegs[1].Micro; }
 	uint GetDataSize() const override { return VU1_PROGSIZE; }
+	void OnPageRestored(u32 offset, u32 size) const override { CpuVU1->Clear(offset, size); }
 };
 
 class SavestateEntry_SPU2 final : public BaseSavestateEntry
@@ -616,9 +782,11 @@ public:
 	~SavestateEntry_SPU2() override = default;
 
 	const char* GetFilename() const override { return "SPU2.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeIn(zf, SPU2_); }
+	bool FreezeIn(const std::vector<u8>* data) const override { return SysState_ComponentFreezeIn(data, SPU2_); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOut(writer, SPU2_); }
 	bool IsRequired() const override { return true; }
+	bool SnapshotIn(std::span<const u8> data) const override { return SysState_ComponentSnapshotIn(data, SPU2_); }
+	bool SnapshotOut(SaveStateBase& writer) const override { return SysState_ComponentSnapshotOut(writer, SPU2_); }
 };
 
 class SavestateEntry_USB final : public BaseSavestateEntry
@@ -627,9 +795,10 @@ public:
 	~SavestateEntry_USB() override = default;
 
 	const char* GetFilename() const override { return "USB.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeInNew(zf, "USB", &USB::DoState); }
+	bool FreezeIn(const std::vector<u8>* data) const override { return SysState_ComponentFreezeInNew(data, "USB", &USB::DoState); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOutNew(writer, "USB", 16 * 1024, &USB::DoState); }
 	bool IsRequired() const override { return false; }
+	bool SnapshotIn(std::span<const u8> data) const override { return SysState_ComponentSnapshotInNew(data, &USB::DoState); }
 };
 
 class SavestateEntry_PAD final : public BaseSavestateEntry
@@ -638,9 +807,10 @@ public:
 	~SavestateEntry_PAD() override = default;
 
 	const char* GetFilename() const override { return "PAD.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeInNew(zf, "PAD", &Pad::Freeze); }
+	bool FreezeIn(const std::vector<u8>* data) const override { return SysState_ComponentFreezeInNew(data, "PAD", &Pad::Freeze); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOutNew(writer, "PAD", 16 * 1024, &Pad::Freeze); }
 	bool IsRequired() const override { return true; }
+	bool SnapshotIn(std::span<const u8> data) const override { return SysState_ComponentSnapshotInNew(data, &Pad::Freeze); }
 };
 
 class SavestateEntry_GS final : public BaseSavestateEntry
@@ -649,9 +819,11 @@ public:
 	~SavestateEntry_GS() = default;
 
 	const char* GetFilename() const { return "GS.bin"; }
-	bool FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, GS); }
+	bool FreezeIn(const std::vector<u8>* data) const override { return SysState_ComponentFreezeIn(data, GS); }
 	bool FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, GS); }
 	bool IsRequired() const { return true; }
+	bool SnapshotIn(std::span<const u8> data) const override { return SysState_ComponentSnapshotIn(data, GSSnapshot); }
+	bool SnapshotOut(SaveStateBase& writer) const override { return SysState_ComponentSnapshotOut(writer, GSSnapshot); }
 };
 
 class SaveStateEntry_Achievements final : public BaseSavestateEntry
@@ -659,17 +831,13 @@ class SaveStateEntry_Achievements final : public BaseSavestateEntry
 	~SaveStateEntry_Achievements() override = default;
 
 	const char* GetFilename() const override { return "Achievements.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override
+	bool FreezeIn(const std::vector<u8>* data) const override
 	{
 		if (!Achievements::IsActive())
 			return true;
 
-		std::optional<std::vector<u8>> data;
-		if (zf)
-			data = ReadBinaryFileInZip(zf);
-
-		if (data.has_value())
-			Achievements::LoadState(data.value());
+		if (data)
+			Achievements::LoadState(*data);
 		else
 			Achievements::LoadState(std::span<const u8>());
 
@@ -686,6 +854,10 @@ class SaveStateEntry_Achievements final : public BaseSavestateEntry
 	}
 
 	bool IsRequired() const override { return false; }
+
+	// Run-ahead frames never reach FrameUpdate(), so there's nothing for a snapshot to roll back.
+	bool SnapshotIn(std::span<const u8> data) const override { return true; }
+	bool IsSnapshotted() const override { return false; }
 };
 
 // (cpuRegs, iopRegs, VPU/GIF/DMAC structures should all remain as part of a larger unified
@@ -725,6 +897,8 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 		return nullptr;
 	}
 
+	WarnIfMTVUEnabled();
+
 	if (!saveme.FreezeInternals(error))
 	{
 		if (!error->IsValid())
@@ -1149,29 +1323,61 @@ static zip_int64_t CheckFileExistsInState(zip_t* zf, const char* name, bool requ
 
 static bool LoadInternalStructuresState(zip_t* zf, s64 index, Error* error)
 {
-	zip_stat_t zst;
-	if (zip_stat_index(zf, index, 0, &zst) != 0 || zst.size > std::numeric_limits<int>::max())
-		return false;
-
 	// Load all the internal data
-	auto zff = zip_fopen_index_managed(zf, index, 0);
-	if (!zff)
-		return false;
-
-	std::vector<u8> buffer(zst.size);
-	if (zip_fread(zff.get(), buffer.data(), buffer.size()) != static_cast<zip_int64_t>(buffer.size()))
+	std::vector<u8> buffer;
+	if (!ReadEntryInZip(zf, index, &buffer))
 		return false;
 
 	memLoadingState state(buffer);
 	if (!state.FreezeBios())
 		return false;
-	
+
+	WarnIfMTVUEnabled();
 	if (!state.FreezeInternals(error))
 		return false;
 
 	return true;
 }
 
+// Entries are independent, so they're decompressed in parallel, which matters most with LZMA2. libzip handles can't
+// be shared between threads, so each extra worker opens the archive again. The calling thread works too.
+static void ReadEntriesInParallel(const std::string& filename, zip_t* zf, const s64* indices, std::vector<u8>* data, bool* read)
+{
+	static constexpr u32 MAX_WORKERS = 4;
+
+	std::atomic<u32> next_entry{0};
+	const auto worker = [&next_entry, indices, data, read](zip_t* wzf) {
+		for (;;)
+		{
+			// Memory is first in the list, so the biggest entries get started first.
+			const u32 i = next_entry.fetch_add(1, std::memory_order_relaxed);
+			if (i >= std::size(SavestateEntries))
+				break;
+
+			read[i] = (indices[i] < 0) || SavestateEntries[i]->ReadIn(wzf, indices[i], &data[i]);
+		}
+	};
+
+	const u32 num_workers = std::clamp<u32>(std::thread::hardware_concurrency(), 1, MAX_WORKERS);
+	std::vector<std::thread> threads;
+	threads.reserve(num_workers - 1);
+	for (u32 i = 1; i < num_workers; i++)
+	{
+		threads.emplace_back([&filename, &worker]() {
+			// If this fails, the other workers pick up its share.
+			zip_error_t ze = {};
+			auto wzf = zip_open_managed(filename.c_str(), ZIP_RDONLY, &ze);
+			if (wzf)
+				worker(wzf.get());
+		});
+	}
+
+	worker(zf);
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
 bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 {
 	zip_error_t ze = {};
@@ -1224,6 +1430,10 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 		return false;
 	}
 
+	std::vector<u8> entryData[std::size(SavestateEntries)];
+	bool entryRead[std::size(SavestateEntries)];
+	ReadEntriesInParallel(filename, zf.get(), entryIndices, entryData, entryRead);
+
 	for (u32 i = 0; i < std::size(SavestateEntries); ++i)
 	{
 		if (entryIndices[i] < 0)
@@ -1232,8 +1442,7 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 			continue;
 		}
 
-		auto zff = zip_fopen_index_managed(zf.get(), entryIndices[i], 0);
-		if (!zff || !SavestateEntries[i]->FreezeIn(zff.get()))
+		if (!entryRead[i] || !SavestateEntries[i]->FreezeIn(&entryData[i]))
 		{
 			Error::SetString(error, fmt::format("Save state corruption in {}.", SavestateEntries[i]->GetFilename()));
 			VMManager::Reset();
@@ -1245,6 +1454,100 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 	return true;
 }
 
+bool SaveState_SaveToMemory(std::vector<u8>& buffer, Error* error)
+{
+	WaitForVMThreads();
+
+	// A new buffer can land where a freed one was, but it doesn't hold its GS snapshot.
+	if (buffer.empty())
+		s_gs_snapshot_data = nullptr;
+
+	// Each block is prefixed with its size, so loading can skip over the internals and restore them last.
+	memSavingState saver(buffer);
+	u32 block_size = 0;
+	uint block_pos = saver.GetCurrentPos();
+	saver.Freeze(block_size);
+	if (!saver.FreezeInternals(error))
+	{
+		if (!error->IsValid())
+			Error::SetString(error, "FreezeInternals() failed");
+
+		return false;
+	}
+
+	block_size = saver.GetCurrentPos() - block_pos - sizeof(block_size);
+	std::memcpy(&buffer[block_pos], &block_size, sizeof(block_size));
+
+	for (const std::unique_ptr<BaseSavestateEntry>& entry : SavestateEntries)
+	{
+		if (!entry->IsSnapshotted())
+			continue;
+
+		block_size = 0;
+		block_pos = saver.GetCurrentPos();
+		saver.Freeze(block_size);
+		if (!entry->SnapshotOut(saver))
+		{
+			Error::SetString(error, fmt::format("SnapshotOut() failed for {}.", entry->GetFilename()));
+			return false;
+		}
+
+		block_size = saver.GetCurrentPos() - block_pos - sizeof(block_size);
+		std::memcpy(&buffer[block_pos], &block_size, sizeof(block_size));
+	}
+
+	return saver.IsOkay();
+}
+
+bool SaveState_LoadFromMemory(const std::vector<u8>& buffer, Error* error)
+{
+	PreSnapshotLoadPrep();
+	s_loading_snapshot = true;
+	ScopedGuard loading_guard([]() { s_loading_snapshot = false; });
+
+	// Memory goes in before the internals, so MTVU picks up the restored VU1 memory when it's reset.
+	memLoadingState loader(buffer);
+	u32 block_size = 0;
+	loader.Freeze(block_size);
+	loader.CommitBlock(block_size);
+
+	for (const std::unique_ptr<BaseSavestateEntry>& entry : SavestateEntries)
+	{
+		if (!entry->IsSnapshotted())
+			continue;
+
+		loader.Freeze(block_size);
+		loader.PrepBlock(block_size);
+		if (!loader.IsOkay() || !entry->SnapshotIn(std::span<const u8>(buffer.data() + loader.GetCurrentPos(), block_size)))
+		{
+			Error::SetString(error, fmt::format("Snapshot corruption in {}.", entry->GetFilename()));
+			VMManager::Reset();
+			return false;
+		}
+
+		loader.CommitBlock(block_size);
+	}
+
+	memLoadingState internals_loader(buffer);
+	internals_loader.Freeze(block_size);
+	if (!internals_loader.FreezeInternals(error))
+	{
+		if (!error->IsValid())
+			Error::SetString(error, "Snapshot corruption in internal structures.");
+
+		VMManager::Reset();
+		return false;
+	}
+
+	PostSnapshotLoadPrep();
+	return true;
+}
+
+bool SaveState_IsLoadingSnapshot()
+{
+	return s_loading_snapshot;
+}
+
 void SaveState_ReportLoadErrorOSD(const std::string& message, std::optional<s32> slot, bool backup)
 {
 	std::string full_message;
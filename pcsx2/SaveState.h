@@ -60,6 +60,12 @@ extern bool SaveState_ZipToDisk(
 extern bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels);
 extern bool SaveState_UnzipFromDisk(const std::string& filename, Error* error);
 
+// Uncompressed snapshots for rolling back a few frames, which can only be loaded into the same VM.
+// Reusing the buffer between snapshots skips copying anything which hasn't changed since the last one.
+extern bool SaveState_SaveToMemory(std::vector<u8>& buffer, Error* error);
+extern bool SaveState_LoadFromMemory(const std::vector<u8>& buffer, Error* error);
+extern bool SaveState_IsLoadingSnapshot();
+
 // --------------------------------------------------------------------------------------
 //  SaveStateBase class
 // --------------------------------------------------------------------------------------
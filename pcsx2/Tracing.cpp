@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Tracing.h"
+
+#include "common/Error.h"
+#include "common/FileSystem.h"
+
+#include "fmt/format.h"
+
+#include <cerrno>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Tracing
+{
+	namespace
+	{
+		// Enough for a few seconds of draw-level zones on a busy thread.
+		static constexpr u32 EVENTS_PER_THREAD = 65536;
+
+		// Slots at the old end of a full ring that export skips, in case the thread is still writing over them.
+		static constexpr u32 EXPORT_GUARD_EVENTS = 1024;
+
+		struct Event
+		{
+			const char* name;
+			u64 start;
+			u64 end;
+		};
+
+		/// Only the owning thread writes. Export reads up to the published count, so no locking on the hot path.
+		struct ThreadBuffer
+		{
+			std::unique_ptr<Event[]> events;
+			std::atomic<u64> count{0};
+			std::string name;
+			u32 id = 0;
+			bool in_use = false;
+		};
+
+		/// Hands the buffer back for reuse when the thread exits.
+		struct ThreadBufferOwner
+		{
+			ThreadBuffer* buffer = nullptr;
+			~ThreadBufferOwner();
+		};
+	} // namespace
+
+	static ThreadBuffer* GetThreadBuffer();
+} // namespace Tracing
+
+std::atomic_bool Tracing::Internal::g_enabled{false};
+
+static std::mutex s_buffers_mutex;
+static std::vector<std::unique_ptr<Tracing::ThreadBuffer>> s_buffers;
+static u64 s_start_time = 0;
+static thread_local Tracing::ThreadBufferOwner s_thread_buffer;
+
+Tracing::ThreadBufferOwner::~ThreadBufferOwner()
+{
+	if (!buffer)
+		return;
+
+	std::unique_lock lock(s_buffers_mutex);
+	buffer->in_use = false;
+}
+
+Tracing::ThreadBuffer* Tracing::GetThreadBuffer()
+{
+	if (s_thread_buffer.buffer) [[likely]]
+		return s_thread_buffer.buffer;
+
+	std::unique_lock lock(s_buffers_mutex);
+
+	// Threads like the SW renderer workers come and go, reuse their buffers rather than piling up new ones.
+	ThreadBuffer* buffer = nullptr;
+	for (const std::unique_ptr<ThreadBuffer>& it : s_buffers)
+	{
+		if (!it->in_use)
+		{
+			buffer = it.get();
+			buffer->count.store(0, std::memory_order_relaxed);
+			break;
+		}
+	}
+	if (!buffer)
+	{
+		buffer = s_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+		buffer->id = static_cast<u32>(s_buffers.size());
+	}
+
+	buffer->name = fmt::format("Thread {}", buffer->id);
+	buffer->in_use = true;
+	s_thread_buffer.buffer = buffer;
+	return buffer;
+}
+
+void Tracing::Start()
+{
+	std::unique_lock lock(s_buffers_mutex);
+	s_start_time = GetCPUTicks();
+	Internal::g_enabled.store(true, std::memory_order_release);
+}
+
+void Tracing::Stop()
+{
+	Internal::g_enabled.store(false, std::memory_order_release);
+}
+
+void Tracing::SetThreadName(const char* name)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+
+	std::unique_lock lock(s_buffers_mutex);
+	buffer->name = name;
+}
+
+void Tracing::RecordZone(const char* name, u64 start, u64 end)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+	if (!buffer->events) [[unlikely]]
+		buffer->events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+
+	const u64 count = buffer->count.load(std::memory_order_relaxed);
+	buffer->events[count % EVENTS_PER_THREAD] = Event{name, start, end};
+	buffer->count.store(count + 1, std::memory_order_release);
+}
+
+bool Tracing::ExportChromeTrace(const std::string& path, Error* error)
+{
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	const double ticks_to_us = 1000000.0 / static_cast<double>(GetTickFrequency());
+
+	std::string out;
+	out.append("{\"traceEvents\":[\n");
+	bool first = true;
+	{
+		std::unique_lock lock(s_buffers_mutex);
+		for (const std::unique_ptr<ThreadBuffer>& buffer : s_buffers)
+		{
+			const u64 count = buffer->count.load(std::memory_order_acquire);
+			if (count == 0)
+				continue;
+
+			fmt::format_to(std::back_inserter(out), "{}{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+				first ? "" : ",\n", buffer->id, buffer->name);
+			first = false;
+
+			// Oldest entries may have been overwritten if the ring wrapped.
+			const u64 oldest = (count > EVENTS_PER_THREAD) ? (count - EVENTS_PER_THREAD + EXPORT_GUARD_EVENTS) : 0;
+			for (u64 i = oldest; i < count; i++)
+			{
+				const Event& ev = buffer->events[i % EVENTS_PER_THREAD];
+				if (ev.start < s_start_time || ev.end < ev.start)
+					continue;
+
+				fmt::format_to(std::back_inserter(out), ",\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+					ev.name, buffer->id, static_cast<double>(ev.start - s_start_time) * ticks_to_us,
+					static_cast<double>(ev.end - ev.start) * ticks_to_us);
+			}
+		}
+	}
+	out.append("\n]}\n");
+
+	if (std::fwrite(out.data(), out.size(), 1, fp.get()) != 1)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		return false;
+	}
+
+	return true;
+}
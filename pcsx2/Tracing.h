@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/HostSys.h"
+
+#include <atomic>
+#include <string>
+
+class Error;
+
+/// Lightweight frame tracing. Zones are recorded into a ring per thread, and can be written out as a Chrome trace
+/// (chrome://tracing, or ui.perfetto.dev) to see which thread and stage a slow frame was spent in.
+namespace Tracing
+{
+	namespace Internal
+	{
+		extern std::atomic_bool g_enabled;
+	} // namespace Internal
+
+	__fi bool IsEnabled()
+	{
+		return Internal::g_enabled.load(std::memory_order_relaxed);
+	}
+
+	/// Starts recording zones. Anything recorded before this is left out of the next export.
+	void Start();
+
+	/// Stops recording zones.
+	void Stop();
+
+	/// Names the calling thread in exported traces.
+	void SetThreadName(const char* name);
+
+	/// Records a zone which has already finished, with times from GetCPUTicks(). Name must be a string literal.
+	void RecordZone(const char* name, u64 start, u64 end);
+
+	/// Writes everything recorded since the last Start() as Chrome trace JSON.
+	bool ExportChromeTrace(const std::string& path, Error* error);
+
+	class ScopedZone
+	{
+	public:
+		__fi ScopedZone(const char* name)
+		{
+			if (IsEnabled()) [[unlikely]]
+			{
+				m_name = name;
+				m_start = GetCPUTicks();
+			}
+		}
+
+		__fi ~ScopedZone()
+		{
+			if (m_name) [[unlikely]]
+				RecordZone(m_name, m_start, GetCPUTicks());
+		}
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		const char* m_name = nullptr;
+		u64 m_start = 0;
+	};
+} // namespace Tracing
+
+#define TRACE_ZONE_CONCAT_(a, b) a##b
+#define TRACE_ZONE_CONCAT(a, b) TRACE_ZONE_CONCAT_(a, b)
+#define TRACE_ZONE(name) Tracing::ScopedZone TRACE_ZONE_CONCAT(trace_zone_, __LINE__)(name)
@@ -12,6 +12,7 @@
 #include "Elfheader.h"
 #include "FW.h"
 #include "GS.h"
+#include "GS/GSCapture.h"
 #include "GS/Renderers/HW/GSTextureReplacements.h"
 #include "GSDumpReplayer.h"
 #include "GameDatabase.h"
@@ -38,6 +39,7 @@
 #include "SIO/Sio2.h"
 #include "SPU2/spu2.h"
 #include "SupportURLs.h"
+#include "Tracing.h"
 #include "USB/USB.h"
 #include "Vif_Dynarec.h"
 #include "VMManager.h"
@@ -137,6 +139,12 @@ namespace VMManager
 
 	static float GetTargetSpeedForLimiterMode(LimiterModeType mode);
 	static void ResetFrameLimiter();
+	static void UpdateLatencyReducedPacing();
+	static void WaitForFrameDeadline(u64 deadline);
+	static void BeginPendingCapture();
+	static void UpdateRunAhead();
+	static bool CanRunAheadThisFrame();
+	static void ExecuteRunAhead();
 
 	static void SetTimerResolutionIncreased(bool enabled);
 	static void SetHardwareDependentDefaultSettings(SettingsInterface& si);
@@ -186,10 +194,27 @@ static bool s_thread_affinities_set = false;
 static LimiterModeType s_limiter_mode = LimiterModeType::Nominal;
 static s64 s_limiter_ticks_per_frame = 0;
 static u64 s_limiter_frame_start = 0;
+static s64 s_limiter_spin_ticks = 0;
+static s64 s_limiter_pacing_offset = 0;
 static float s_target_speed = 0.0f;
 static bool s_target_speed_can_sync_to_host = false;
 static bool s_target_speed_synced_to_host = false;
 static bool s_use_vsync_for_timing = false;
+static bool s_offline_render = false;
+static std::string s_pending_capture_filename;
+
+// Run-ahead emulates the real frame unseen, snapshots it, then emulates the frames after it and shows
+// only the last, before rolling back. The snapshot buffer is kept between frames so it's only sized once.
+enum class RunAheadStage : u8
+{
+	Inactive,
+	RealFrame,
+	AheadFrame,
+	LastAheadFrame,
+};
+static RunAheadStage s_run_ahead_stage = RunAheadStage::Inactive;
+static u32 s_run_ahead_frames = 0;
+static std::vector<u8> s_run_ahead_state;
 
 // Used to track play time. We use a monotonic timer here, in case of clock changes.
 static u64 s_session_resume_timestamp = 0;
@@ -378,6 +403,7 @@ const std::string& VMManager::GetCurrentELF()
 bool VMManager::Internal::CPUThreadInitialize()
 {
 	Threading::SetNameOfCurrentThread("CPU Thread");
+	Tracing::SetThreadName("CPU Thread");
 	PerformanceMetrics::SetCPUThread(Threading::ThreadHandle::GetForCallingThread());
 
 	// On Win32, we have a bunch of things which use COM (e.g. SDL, XAudio2, etc).
@@ -1505,6 +1531,9 @@ VMBootResult VMManager::Initialize(const VMBootParameters& boot_params, Error* e
 	if (Achievements::IsHardcoreModeActive() && (!state_to_load.empty() || DebugInterface::getPauseOnEntry()))
 		return VMBootResult::PromptDisableHardcoreMode;
 
+	s_offline_render = boot_params.offline_render;
+	s_pending_capture_filename = boot_params.capture_filename;
+
 	if (boot_params.start_unlimited.value_or(false))
 		s_limiter_mode = LimiterModeType::Unlimited;
 	else if (boot_params.start_turbo.value_or(false))
@@ -1642,6 +1671,7 @@ VMBootResult VMManager::Initialize(const VMBootParameters& boot_params, Error* e
 		}
 	}
 
+	UpdateRunAhead();
 	PerformanceMetrics::Clear();
 	return VMBootResult::StartupSuccess;
 }
@@ -1675,6 +1705,14 @@ void VMManager::Shutdown(bool save_resume_state)
 	if (g_InputRecording.isActive())
 		g_InputRecording.stop();
 
+	// GS is idle now, so the frame time stats won't change under us. Overwritten each session, like the log.
+	if (PerformanceMetrics::GetFrameNumber() > 0)
+	{
+		Error error;
+		if (!PerformanceMetrics::WriteReport(Path::Combine(EmuFolders::Logs, "perfreport.json"), &error))
+			ERROR_LOG("Failed to write performance report: {}", error.GetDescription());
+	}
+
 	SaveSessionTime(s_disc_serial);
 	s_elf_override = {};
 	ClearELFInfo();
@@ -1691,6 +1729,10 @@ void VMManager::Shutdown(bool save_resume_state)
 	Host::OnGameChanged(s_title, std::string(), std::string(), s_disc_serial, 0, 0);
 
 	s_fast_boot_requested = false;
+	s_offline_render = false;
+	s_pending_capture_filename = {};
+	s_run_ahead_frames = 0;
+	s_run_ahead_state = {};
 
 	UpdateGameSettingsLayer();
 
@@ -1900,6 +1942,7 @@ bool VMManager::DoLoadState(const char* filename, Error* error)
 	}
 
 	Host::OnSaveStateLoading(filename);
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::SaveState);
 
 	if (!SaveState_UnzipFromDisk(filename, error))
 		return false;
@@ -1923,6 +1966,8 @@ void VMManager::DoSaveState(const char* filename, s32 slot_for_message, bool zip
 		return;
 	}
 
+	PerformanceMetrics::RecordStutterSource(PerformanceMetrics::StutterSource::SaveState);
+
 	Error error;
 	std::unique_ptr<ArchiveEntryList> elist = SaveState_DownloadState(&error);
 	if (!elist)
@@ -2175,8 +2220,17 @@ float VMManager::GetTargetSpeed()
 	return s_target_speed;
 }
 
+bool VMManager::IsOfflineRendering()
+{
+	return s_offline_render;
+}
+
 float VMManager::GetTargetSpeedForLimiterMode(LimiterModeType mode)
 {
+	// Capture and audio both block on the encoder, so there's nothing to pace against.
+	if (s_offline_render)
+		return 0.0f;
+
 	if (EmuConfig.EnableFastBootFastForward && VMManager::Internal::IsFastBootInProgress())
 		return 0.0f;
 
@@ -2264,6 +2318,54 @@ float VMManager::GetFrameRate()
 void VMManager::ResetFrameLimiter()
 {
 	s_limiter_frame_start = GetCPUTicks();
+	s_limiter_pacing_offset = 0;
+}
+
+void VMManager::UpdateLatencyReducedPacing()
+{
+	// Only does anything when the present blocks on vsync and our timer is what's pacing the frames.
+	if (!EmuConfig.EmulationSpeed.LatencyReducedPacing || GetEffectiveVSyncMode() != GSVSyncMode::FIFO ||
+		(s_target_speed != 1.0f && !s_target_speed_synced_to_host))
+	{
+		s_limiter_frame_start -= s_limiter_pacing_offset;
+		s_limiter_pacing_offset = 0;
+		return;
+	}
+
+	// Time the GS spends blocked in present is time the frame could have started later, with fresher input.
+	// Nudge the frame start later until only a small margin is left, a bit at a time so one slow frame doesn't
+	// throw it off. The offset never goes negative, so we can't end up running ahead of the normal schedule.
+	static constexpr double PRESENT_WAIT_MARGIN_MS = 2.0;
+	static constexpr s64 CORRECTION_DIVISOR = 8;
+	const double error_ms = static_cast<double>(PerformanceMetrics::GetPresentWaitTime()) - PRESENT_WAIT_MARGIN_MS;
+	const s64 correction = static_cast<s64>(error_ms * static_cast<double>(GetTickFrequency()) / 1000.0) / CORRECTION_DIVISOR;
+	const s64 new_offset = std::clamp<s64>(s_limiter_pacing_offset + correction, 0, s_limiter_ticks_per_frame / 2);
+	s_limiter_frame_start += new_offset - s_limiter_pacing_offset;
+	s_limiter_pacing_offset = new_offset;
+}
+
+void VMManager::WaitForFrameDeadline(u64 deadline)
+{
+	// Sleep through most of the wait, then spin the rest. The spin window follows how late the OS actually wakes
+	// us, which with clock_nanosleep() on Linux is tens of microseconds, rather than assuming a millisecond or two.
+	const s64 min_spin_ticks = static_cast<s64>(GetTickFrequency() / 20000); // 50us
+	const s64 max_spin_ticks = static_cast<s64>(GetTickFrequency() / 500); // 2ms
+	if (s_limiter_spin_ticks == 0)
+		s_limiter_spin_ticks = max_spin_ticks;
+
+	const u64 wake_time = deadline - static_cast<u64>(s_limiter_spin_ticks);
+	if (static_cast<s64>(wake_time - GetCPUTicks()) > 0)
+	{
+		Threading::SleepUntil(wake_time);
+
+		// Widen straight away after a late wake, narrow slowly otherwise.
+		const s64 oversleep = std::max<s64>(static_cast<s64>(GetCPUTicks() - wake_time), 0);
+		s_limiter_spin_ticks = std::clamp(std::max(oversleep + oversleep / 2, s_limiter_spin_ticks - s_limiter_spin_ticks / 64),
+			min_spin_ticks, max_spin_ticks);
+	}
+
+	while (GetCPUTicks() < deadline)
+		Threading::SpinWait();
 }
 
 void VMManager::Internal::Throttle()
@@ -2271,6 +2373,8 @@ void VMManager::Internal::Throttle()
 	if (s_target_speed == 0.0f || s_use_vsync_for_timing)
 		return;
 
+	UpdateLatencyReducedPacing();
+
 	const u64 uExpectedEnd =
 		s_limiter_frame_start +
 		s_limiter_ticks_per_frame; // Compute when we would expect this frame to end, assuming everything goes perfectly perfect.
@@ -2285,22 +2389,7 @@ void VMManager::Internal::Throttle()
 		return;
 	}
 
-	// Conversion of delta from CPU ticks (microseconds) to milliseconds
-	const s32 msec = static_cast<s32>((sDeltaTime * -1000) / static_cast<s64>(GetTickFrequency()));
-
-	// If any integer value of milliseconds exists, sleep it off.
-	// Prior comments suggested that 1-2 ms sleeps were inaccurate on some OSes;
-	// further testing suggests instead that this was utter bullshit.
-	if (msec > 1)
-	{
-		Threading::Sleep(msec - 1);
-	}
-
-	// Conversion to milliseconds loses some precision; after sleeping off whole milliseconds,
-	// spin the thread without sleeping until we finally reach our expected end time.
-	while (GetCPUTicks() < uExpectedEnd)
-	{
-	}
+	WaitForFrameDeadline(uExpectedEnd);
 
 	// Finally, set our next frame start to when this one ends
 	s_limiter_frame_start = uExpectedEnd;
@@ -2764,10 +2853,106 @@ void VMManager::Execute()
 		vtlb_ResetFastmem();
 	}
 
+	if (s_run_ahead_frames > 0 && CanRunAheadThisFrame())
+	{
+		ExecuteRunAhead();
+		return;
+	}
+
 	// Execute until we're asked to stop.
 	Cpu->Execute();
 }
 
+void VMManager::UpdateRunAhead()
+{
+	s_run_ahead_frames = static_cast<u32>(EmuConfig.EmulationSpeed.RunAheadFrames);
+	if (s_run_ahead_frames == 0)
+	{
+		s_run_ahead_state = {};
+		return;
+	}
+
+	// Loading a state resets the hardware texture cache, so every frame would have to be redrawn from scratch.
+	if (EmuConfig.GS.UseHardwareRenderer())
+	{
+		Host::AddIconOSDMessage("RunAhead", ICON_FA_TRIANGLE_EXCLAMATION,
+			TRANSLATE_STR("VMManager", "Run-ahead is only supported with the software renderer, and has been disabled."),
+			Host::OSD_WARNING_DURATION);
+		s_run_ahead_frames = 0;
+		s_run_ahead_state = {};
+	}
+}
+
+bool VMManager::CanRunAheadThisFrame()
+{
+	// Anything which needs every emulated frame to be a real one.
+	// HostFs reopens its files on every state load, and memory card writes would be repeated after the rollback.
+	// DEV9 isn't in savestates at all, so network packets and HDD writes would be repeated, and never rolled back.
+	return (s_frame_advance_count == 0 && !s_offline_render && s_pending_capture_filename.empty() &&
+			!GSCapture::IsCapturing() && !GSIsSnapshotPending() && !g_InputRecording.isActive() &&
+			!GSDumpReplayer::IsReplayingDump() && !EmuConfig.HostFs && !MemcardBusy::IsBusy() &&
+			!EmuConfig.DEV9.EthEnable && !EmuConfig.DEV9.HddEnable);
+}
+
+void VMManager::ExecuteRunAhead()
+{
+	// The real frame is heard, but not seen, input is polled at the end of it.
+	s_run_ahead_stage = RunAheadStage::RealFrame;
+	Cpu->Execute();
+	s_run_ahead_stage = RunAheadStage::Inactive;
+	if (Internal::IsExecutionInterrupted())
+		return;
+
+	Error error;
+	if (!SaveState_SaveToMemory(s_run_ahead_state, &error))
+	{
+		Console.Error(fmt::format("Failed to save run-ahead state: {}", error.GetDescription()));
+		Host::AddIconOSDMessage("RunAhead", ICON_FA_TRIANGLE_EXCLAMATION,
+			TRANSLATE_STR("VMManager", "Run-ahead has been disabled, because the state could not be saved."),
+			Host::OSD_ERROR_DURATION);
+		s_run_ahead_frames = 0;
+		s_run_ahead_state = {};
+		return;
+	}
+
+	// Then the frames after it are emulated with that input, and only the last is shown.
+	SPU2::SetOutputDiscarded(true);
+	for (u32 i = 1; i <= s_run_ahead_frames; i++)
+	{
+		s_run_ahead_stage = (i == s_run_ahead_frames) ? RunAheadStage::LastAheadFrame : RunAheadStage::AheadFrame;
+		Cpu->Execute();
+	}
+	s_run_ahead_stage = RunAheadStage::Inactive;
+	SPU2::SetOutputDiscarded(false);
+
+	const bool loaded = SaveState_LoadFromMemory(s_run_ahead_state, &error);
+	FileMcd_DiscardDeferredWrites();
+	if (!loaded)
+	{
+		Console.Error(fmt::format("Failed to load run-ahead state: {}", error.GetDescription()));
+		Host::AddIconOSDMessage("RunAhead", ICON_FA_TRIANGLE_EXCLAMATION,
+			TRANSLATE_STR("VMManager", "Run-ahead has been disabled, because the state could not be loaded. The system has been reset."),
+			Host::OSD_ERROR_DURATION);
+		s_run_ahead_frames = 0;
+		s_run_ahead_state = {};
+	}
+}
+
+bool VMManager::Internal::IsFrameHidden()
+{
+	return (s_run_ahead_stage == RunAheadStage::RealFrame || s_run_ahead_stage == RunAheadStage::AheadFrame);
+}
+
+bool VMManager::Internal::IsRunAheadFrame()
+{
+	return (s_run_ahead_stage == RunAheadStage::AheadFrame || s_run_ahead_stage == RunAheadStage::LastAheadFrame);
+}
+
+bool VMManager::Internal::IsRunningAhead()
+{
+	return (s_run_ahead_stage != RunAheadStage::Inactive);
+}
+
 void VMManager::IdlePollUpdate()
 {
 	Achievements::IdleUpdate();
@@ -2908,10 +3093,25 @@ void VMManager::Internal::EntryPointCompilingOnCPUThread()
 
 void VMManager::Internal::VSyncOnCPUThread()
 {
+	if (s_run_ahead_stage != RunAheadStage::Inactive)
+	{
+		// Run-ahead goes a frame at a time. Frames past the real one are rolled back, so they can't be
+		// allowed to consume input or change anything outside the VM.
+		Cpu->ExitExecution();
+		if (s_run_ahead_stage != RunAheadStage::RealFrame)
+		{
+			Patch::ApplyVsyncPatches();
+			return;
+		}
+	}
+
 	Pad::UpdateMacroButtons();
 
 	Patch::ApplyVsyncPatches();
 
+	if (!s_pending_capture_filename.empty()) [[unlikely]]
+		BeginPendingCapture();
+
 	// Frame advance must be done *before* pumping messages, because otherwise
 	// we'll immediately reduce the counter we just set.
 	if (s_frame_advance_count > 0)
@@ -2929,8 +3129,40 @@ void VMManager::Internal::VSyncOnCPUThread()
 	PollDiscordPresence();
 }
 
+void VMManager::BeginPendingCapture()
+{
+	// Auto resolution has nothing to go on until the game puts something on screen, so keep trying each vsync.
+	// Waiting for the GS thread means the first video frame and audio packet come from the same vsync.
+	std::optional<bool> started;
+	MTGS::RunOnGSThread([&started, filename = s_pending_capture_filename]() mutable {
+		int width, height;
+		GSgetInternalResolution(&width, &height);
+		if (GSConfig.VideoCaptureAutoResolution && (width <= 0 || height <= 0))
+			return;
+
+		started = GSBeginCapture(std::move(filename));
+	});
+	MTGS::WaitGS(false, false, false);
+	if (!started.has_value())
+		return;
+
+	if (!started.value())
+	{
+		Console.Error(fmt::format("Failed to start capture to '{}'.", s_pending_capture_filename));
+
+		// No point rendering the rest of it if nothing's going to be written.
+		if (s_offline_render)
+			Host::RequestVMShutdown(false, false, false);
+	}
+
+	s_pending_capture_filename = {};
+}
+
 void VMManager::Internal::PollInputOnCPUThread()
 {
+	if (s_run_ahead_stage == RunAheadStage::AheadFrame || s_run_ahead_stage == RunAheadStage::LastAheadFrame)
+		return;
+
 	Host::PumpMessagesOnCPUThread();
 	InputManager::PollSources();
 
@@ -2965,8 +3197,11 @@ void VMManager::CheckForCPUConfigChanges(const Pcsx2Config& old_config)
 	Internal::ClearCPUExecutionCaches();
 	memBindConditionalHandlers();
 
-	if (EmuConfig.Cpu.Recompiler.EnableFastmem != old_config.Cpu.Recompiler.EnableFastmem)
+	if (EmuConfig.Cpu.Recompiler.EnableFastmem != old_config.Cpu.Recompiler.EnableFastmem ||
+		EmuConfig.Cpu.Recompiler.EnableSubPageSMC != old_config.Cpu.Recompiler.EnableSubPageSMC)
+	{
 		vtlb_ResetFastmem();
+	}
 
 	// did we toggle recompilers?
 	if (EmuConfig.Cpu.CpusChanged(old_config.Cpu))
@@ -2985,6 +3220,9 @@ void VMManager::CheckForGSConfigChanges(const Pcsx2Config& old_config)
 
 	Console.WriteLn("Updating GS configuration...");
 
+	if (HasValidVM() && EmuConfig.GS.UseHardwareRenderer() != old_config.GS.UseHardwareRenderer())
+		UpdateRunAhead();
+
 	// We could just check whichever NTSC or PAL is appropriate for our current mode,
 	// but people _really_ shouldn't be screwing with framerate, so whatever.
 	if (EmuConfig.GS.FramerateNTSC != old_config.GS.FramerateNTSC ||
@@ -3011,6 +3249,9 @@ void VMManager::CheckForEmulationSpeedConfigChanges(const Pcsx2Config& old_confi
 
 	Console.WriteLn("Updating emulation speed configuration");
 	UpdateTargetSpeed();
+
+	if (EmuConfig.EmulationSpeed.RunAheadFrames != old_config.EmulationSpeed.RunAheadFrames)
+		UpdateRunAhead();
 }
 
 void VMManager::CheckForPatchConfigChanges(const Pcsx2Config& old_config)
@@ -3178,6 +3419,9 @@ void VMManager::EnforceAchievementsChallengeModeSettings()
 		EmuConfig.EnableCheats = false;
 	}
 
+	// Run-ahead loads a state every frame.
+	EmuConfig.EmulationSpeed.RunAheadFrames = 0;
+
 	// Input recording/playback is probably an issue.
 	EmuConfig.EnableRecordingTools = false;
 	EmuConfig.EnablePINE = false;
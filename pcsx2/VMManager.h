@@ -40,6 +40,12 @@ struct VMBootParameters
 	std::optional<bool> start_turbo;
 	std::optional<bool> start_unlimited;
 	bool disable_achievements_hardcore_mode = false;
+
+	/// Starts a video capture to this file as soon as the game has something on screen.
+	std::string capture_filename;
+
+	/// Runs unthrottled regardless of the limiter mode, for rendering captures offline.
+	bool offline_render = false;
 };
 
 enum class VMBootResult
@@ -192,6 +198,9 @@ namespace VMManager
 	/// Returns the target speed, based on the limiter mode.
 	float GetTargetSpeed();
 
+	/// Returns true if the VM was booted for offline rendering, and is ignoring the limiter.
+	bool IsOfflineRendering();
+
 	/// Ensures the target speed reflects the current configuration. Call if you change anything in
 	/// EmuConfig.EmulationSpeed without going through the usual config apply.
 	void UpdateTargetSpeed();
@@ -324,6 +333,15 @@ namespace VMManager
 		/// Resets/clears all execution/code caches.
 		void ClearCPUExecutionCaches();
 
+		/// Returns true if run-ahead is keeping the current frame off screen. Hidden frames aren't throttled.
+		bool IsFrameHidden();
+
+		/// Returns true if the current frame will be rolled back once run-ahead has shown it.
+		bool IsRunAheadFrame();
+
+		/// Returns true if the current frame is any part of a run-ahead cycle, including the real one.
+		bool IsRunningAhead();
+
 		/// Returns a list of processors in the system, suitable for pinning for the software renderer.
 		const std::vector<u32>& GetSoftwareRendererProcessorList();
 
@@ -17,6 +17,7 @@
 #include "VUmicro.h"
 #include "Vif_Dma.h"
 #include "MTVU.h"
+#include "MTVU0.h"
 
 #define _Ft_ _Rt_
 #define _Fs_ _Rd_
@@ -43,6 +44,10 @@ void COP2_Unknown()
 
 __fi void _vu0run(bool breakOnMbit, bool addCycles, bool sync_only) {
 
+	// Programs on the VU0 thread always run to the end, there is nothing to catch up
+	if (vu0Thread.IsPending())
+		vu0Thread.WaitVU();
+
 	if (!(VU0.VI[REG_VPU_STAT].UL & 1)) return;
 
 	//VU0 is ahead of the EE and M-Bit is already encountered, so no need to wait for it, just catch up the EE
@@ -6,6 +6,7 @@
 
 #include "Common.h"
 #include "VUmicro.h"
+#include "MTVU0.h"
 
 #include <cmath>
 
@@ -66,5 +67,8 @@ void vu0ExecMicro(u32 addr) {
 
 	CpuVU0->SetStartPC(VU0.VI[REG_TPC].UL << 3);
 	_vuExecMicroDebug(VU0);
-	CpuVU0->ExecuteBlock(1);
+	if (THREAD_VU0)
+		vu0Thread.ExecuteVU();
+	else
+		CpuVU0->ExecuteBlock(1);
 }
@@ -4,6 +4,7 @@
 #include "Common.h"
 #include "VUmicro.h"
 #include "MTVU.h"
+#include "MTVU0.h"
 #include "GS.h"
 #include "Gif_Unit.h"
 
@@ -35,6 +36,12 @@ void BaseVUmicroCPU::ExecuteBlock(bool startUp)
 		return;
 	}
 
+	if (!m_Idx && vu0Thread.IsPending())
+	{
+		vu0Thread.Poll();
+		return;
+	}
+
 	if (!(stat & test))
 	{
 		// VU currently flushes XGKICK on VU1 end so no need for this, yet
@@ -68,6 +75,9 @@ void BaseVUmicroCPU::ExecuteBlockJIT(BaseVUmicroCPU* cpu, bool interlocked)
 	const u32& stat = VU0.VI[REG_VPU_STAT].UL;
 	constexpr int test = 1;
 
+	if (vu0Thread.IsPending())
+		vu0Thread.WaitVU();
+
 	if (stat & test)
 	{ // VU is running
 		s64 delta = (s64)(u64)(cpuRegs.cycle - VU0.cycle);
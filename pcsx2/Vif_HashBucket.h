@@ -3,11 +3,12 @@
 
 #pragma once
 
-#include <array>
 #include "common/AlignedMalloc.h"
 
+#include <cstring>
+
 // nVifBlock - Ordered for Hashing; the 'num' and 'upkType' fields are
-//             used as the hash bucket selector.
+//             the most diverse, and make up the low bits of the hash.
 union nVifBlock
 {
 	// Warning: order depends on the newVifDynaRec code
@@ -35,101 +36,111 @@ union nVifBlock
 
 }; // 16 bytes
 
-// 0x4000 is enough but 0x10000 allow
-// * to skip the compare value of the first double world in lookup
-// * to use a 16 bits move instead of an 'and' mask to compute the hashed key
-#define hSize 0x10000 // [usn*1:mask*1:upk*4:num*8] hash...
+// Number of slots in the table. Must be a power of two. Real games rarely go past a
+// few hundred unique blocks, so this leaves plenty of room before the load cap.
+static constexpr u32 hSize = 0x4000;
+
+// Once this many slots are in use, full() asks the caller to flush the cache,
+// since probe lengths grow quickly past this point.
+static constexpr u32 hMaxLoad = hSize * 3 / 4;
 
-// HashBucket is a container which uses a built-in hash function
-// to perform quick searches. It is designed around the nVifBlock structure
+// HashBucket is an open-addressed table of nVifBlocks, using linear probing.
 //
-// The hash function is determined by taking the first bytes of data and
-// performing a modulus the size of hSize. So the most diverse-data should
-// be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
+// All blocks live in one flat, cache line aligned array, so a lookup is a hash
+// and a short forward scan over neighbouring lines, which the hardware prefetcher
+// handles well. Slots are never removed individually, the whole table is flushed
+// together with the code cache that it points into.
 class HashBucket
 {
 protected:
-	std::array<nVifBlock*, hSize> m_bucket;
+	nVifBlock* m_table = nullptr;
+	u32 m_used = 0;
 
-public:
-	HashBucket()
+	u64 m_hits = 0;
+	u64 m_misses = 0;
+
+	static __fi u32 hash(const nVifBlock& dataPtr)
 	{
-		m_bucket.fill(nullptr);
+		// num/upkType are the most diverse, but mask and mode/cl/wl still need to
+		// be mixed in, or blocks differing only there would probe the same run.
+		u32 h = dataPtr.hash_key;
+		h ^= dataPtr.key0 * 0x9E3779B1u;
+		h ^= dataPtr.key1 * 0x85EBCA77u;
+		h ^= h >> 15;
+		return h & (hSize - 1);
 	}
 
+	static __fi bool matches(const nVifBlock& a, const nVifBlock& b)
+	{
+		return a.hash_key == b.hash_key && a.key0 == b.key0 && a.key1 == b.key1;
+	}
+
+public:
+	HashBucket() = default;
 	~HashBucket() { clear(); }
 
 	__fi nVifBlock* find(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
-
-		while (true)
+		for (u32 i = hash(dataPtr);; i = (i + 1) & (hSize - 1))
 		{
-			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
-				return chainpos;
-
-			if (chainpos->startPtr == 0)
+			nVifBlock* slot = &m_table[i];
+			if (slot->startPtr == 0) [[unlikely]]
+			{
+				m_misses++;
 				return nullptr;
+			}
 
-			chainpos++;
+			if (matches(*slot, dataPtr))
+			{
+				m_hits++;
+				return slot;
+			}
 		}
 	}
 
-	void add(const nVifBlock& dataPtr)
-	{
-		u32 b = dataPtr.hash_key;
-
-		u32 size = bucket_size(dataPtr);
+	/// Returns true when no more blocks should be added until the next reset().
+	__fi bool full() const { return m_used >= hMaxLoad; }
 
-		// Warning there is an extra +1 due to the empty cell
-		// Performance note: 64B align to reduce cache miss penalty in `find`
-		if ((m_bucket[b] = (nVifBlock*)pcsx2_aligned_realloc(m_bucket[b], sizeof(nVifBlock) * (size + 2), 64, sizeof(nVifBlock) * (size + 1))) == NULL)
-		{
-			pxFailRel("Failed to allocate HashBucket Chain");
-		}
-
-		// Replace the empty cell by the new block and create a new empty cell
-		memcpy(&m_bucket[b][size++], &dataPtr, sizeof(nVifBlock));
-		memset(&m_bucket[b][size], 0, sizeof(nVifBlock));
-
-		if (size > 3)
-			DevCon.Warning("recVifUnpk: Bucket 0x%04x has %d micro-programs", b, size);
-	}
-
-	u32 bucket_size(const nVifBlock& dataPtr)
+	nVifBlock* add(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+		pxAssert(!full());
 
-		u32 size = 0;
+		u32 i = hash(dataPtr);
+		while (m_table[i].startPtr != 0)
+			i = (i + 1) & (hSize - 1);
 
-		while (chainpos->startPtr != 0)
-		{
-			size++;
-			chainpos++;
-		}
-
-		return size;
+		std::memcpy(&m_table[i], &dataPtr, sizeof(nVifBlock));
+		m_used++;
+		return &m_table[i];
 	}
 
+	u32 size() const { return m_used; }
+	u64 hits() const { return m_hits; }
+	u64 misses() const { return m_misses; }
+
 	void clear()
 	{
-		for (auto& bucket : m_bucket)
-			safe_aligned_free(bucket);
+		safe_aligned_free(m_table);
+		m_used = 0;
 	}
 
 	void reset()
 	{
-		clear();
-
-		// Allocate an empty cell for all buckets
-		for (auto& bucket : m_bucket)
+		if (m_hits || m_misses)
 		{
-			if ((bucket = (nVifBlock*)_aligned_malloc(sizeof(nVifBlock), 16)) == nullptr)
-			{
-				pxFailRel("Failed to allocate HashBucket Chain on reset");
-			}
-
-			memset(bucket, 0, sizeof(nVifBlock));
+			DevCon.WriteLn("recVifUnpk: %u blocks, %.2f%% hit rate over %llu lookups", m_used,
+				(static_cast<double>(m_hits) * 100.0) / static_cast<double>(m_hits + m_misses),
+				static_cast<unsigned long long>(m_hits + m_misses));
 		}
+
+		m_hits = 0;
+		m_misses = 0;
+		m_used = 0;
+
+		// Performance note: 64B align to reduce cache miss penalty in `find`
+		if (!m_table && !(m_table = static_cast<nVifBlock*>(_aligned_malloc(sizeof(nVifBlock) * hSize, 64))))
+			pxFailRel("Failed to allocate HashBucket table on reset");
+
+		std::memset(m_table, 0, sizeof(nVifBlock) * hSize);
 	}
 };
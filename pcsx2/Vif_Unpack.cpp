@@ -6,35 +6,31 @@
 #include "Vif_Dma.h"
 #include "Vif_Dynarec.h"
 #include "MTVU.h"
-
-enum UnpackOffset {
-	OFFSET_X = 0,
-	OFFSET_Y = 1,
-	OFFSET_Z = 2,
-	OFFSET_W = 3
-};
-
-static __fi u32 setVifRow(vifStruct& vif, u32 reg, u32 data) {
-	vif.MaskRow._u32[reg] = data;
-	return data;
-}
+#include "GS/GSVector.h"
 
 // cycle derives from vif.cl
 // mode derives from vifRegs.mode
+//
+// All four fields are handled at once. Fields are independent of each other, so this
+// matches writing X, Y, Z and W in turn, one at a time.
 template< uint idx, uint mode, bool doMask >
-static __ri void writeXYZW(u32 offnum, u32 &dest, u32 data) {
-	int n = 0;
-
+static __ri void writeXYZW(u32* dest, const GSVector4i& data) {
 	vifStruct& vif = MTVU_VifX;
 
-	if (doMask) {
-		const VIFregisters& regs = MTVU_VifXRegs;
-		switch (vif.cl) {
-			case 0:  n = (regs.mask >> (offnum * 2)) & 0x3;		break;
-			case 1:  n = (regs.mask >> ( 8 + (offnum * 2))) & 0x3;	break;
-			case 2:  n = (regs.mask >> (16 + (offnum * 2))) & 0x3;	break;
-			default: n = (regs.mask >> (24 + (offnum * 2))) & 0x3;	break;
-		}
+	const GSVector4i row = GSVector4i::load<true>(&vif.MaskRow);
+	GSVector4i out, newRow;
+	switch (mode) {
+		case 1:  out = data.add32(row); break;
+		case 2:  out = newRow = row.add32(data); break;
+		case 3:  out = newRow = data; break;
+		default: out = data; break;
+	}
+
+	if (!doMask) {
+		if (mode == 2 || mode == 3)
+			GSVector4i::store<true>(&vif.MaskRow, newRow);
+		GSVector4i::store<false>(dest, out);
+		return;
 	}
 
 	// Four possible types of masking are handled below:
@@ -42,33 +38,35 @@ static __ri void writeXYZW(u32 offnum, u32 &dest, u32 data) {
 	//   1 - MaskRow
 	//   2 - MaskCol
 	//   3 - Write protect
-
-	switch (n) {
-		case 0:
-			switch (mode) {
-				case 1:  dest = data + vif.MaskRow._u32[offnum]; break;
-				case 2:  dest = setVifRow(vif, offnum, vif.MaskRow._u32[offnum] + data); break;
-				case 3:  dest = setVifRow(vif, offnum, data); break;
-				default: dest = data; break;
-			}
-			break;
-		case 1: dest = vif.MaskRow._u32[offnum]; break;
-		case 2: dest = vif.MaskCol._u32[std::min(vif.cl,3)]; break;
-		case 3: break;
-	}
+	const VIFregisters& regs = MTVU_VifXRegs;
+	const int cl = std::min(vif.cl, 3);
+	const u32 m  = regs.mask >> (cl * 8);
+	const GSVector4i n = GSVector4i(m, m >> 2, m >> 4, m >> 6) & GSVector4i(3);
+
+	// Only the fields which write data update the row
+	const GSVector4i isData = n.eq32(GSVector4i::zero());
+	if (mode == 2 || mode == 3)
+		GSVector4i::store<true>(&vif.MaskRow, row.blend8(newRow, isData));
+
+	out = out.blend8(row, n.eq32(GSVector4i(1)));
+	out = out.blend8(GSVector4i(static_cast<int>(vif.MaskCol._u32[cl])), n.eq32(GSVector4i(2)));
+	out = out.blend8(GSVector4i::load<false>(dest), n.eq32(GSVector4i(3)));
+	GSVector4i::store<false>(dest, out);
 }
 #define tParam idx,mode,doMask
 
+// Converts one source element to a field, sign or zero extending per T
+template < class T >
+static __fi int vifField(const T* src)
+{
+	return static_cast<int>(static_cast<u32>(*src));
+}
+
 template < uint idx, uint mode, bool doMask, class T >
 static void UNPACK_S(u32* dest, const T* src)
 {
-	u32 data = *src;
-
 	//S-# will always be a complete packet, no matter what. So we can skip the offset bits
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), data);
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), data);
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), data);
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), data);
+	writeXYZW<tParam>(dest, GSVector4i(vifField(src)));
 }
 
 // The PS2 console actually writes v1v0v1v0 for all V2 unpacks -- the second v1v0 pair
@@ -76,10 +74,9 @@ static void UNPACK_S(u32* dest, const T* src)
 template < uint idx, uint mode, bool doMask, class T >
 static void UNPACK_V2(u32* dest, const T* src)
 {
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+0));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+1));
+	const int x = vifField(src + 0);
+	const int y = vifField(src + 1);
+	writeXYZW<tParam>(dest, GSVector4i(x, y, x, y));
 }
 
 // V3 and V4 unpacks both use the V4 unpack logic, even though most of the OFFSET_W fields
@@ -88,22 +85,30 @@ static void UNPACK_V2(u32* dest, const T* src)
 template < uint idx, uint mode, bool doMask, class T >
 static void UNPACK_V4(u32* dest, const T* src)
 {
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+2));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+3));
+	GSVector4i data;
+	if constexpr (sizeof(T) == 4) {
+		data = GSVector4i::load<false>(src);
+	}
+	else if constexpr (sizeof(T) == 2) {
+		const GSVector4i v = GSVector4i::loadl(src);
+		data = std::is_signed_v<T> ? v.i16to32() : v.u16to32();
+	}
+	else {
+		u32 packed;
+		std::memcpy(&packed, src, sizeof(packed));
+		const GSVector4i v = GSVector4i::load(static_cast<int>(packed));
+		data = std::is_signed_v<T> ? v.i8to32() : v.u8to32();
+	}
+	writeXYZW<tParam>(dest, data);
 }
 
 // V4_5 unpacks do not support the MODE register, and act as mode==0 always.
 template< uint idx, bool doMask >
 static void UNPACK_V4_5(u32 *dest, const u32* src)
 {
-	u32 data = *src;
-
-	writeXYZW<idx,0,doMask>(OFFSET_X, *(dest+0),	((data & 0x001f) << 3));
-	writeXYZW<idx,0,doMask>(OFFSET_Y, *(dest+1),	((data & 0x03e0) >> 2));
-	writeXYZW<idx,0,doMask>(OFFSET_Z, *(dest+2),	((data & 0x7c00) >> 7));
-	writeXYZW<idx,0,doMask>(OFFSET_W, *(dest+3),	((data & 0x8000) >> 8));
+	const int data = static_cast<int>(*src);
+	const GSVector4i v = GSVector4i(data << 3, data >> 2, data >> 7, data >> 8);
+	writeXYZW<idx,0,doMask>(dest, v & GSVector4i(0xf8, 0xf8, 0xf8, 0x80));
 }
 
 static void UNPACK_INVALID(u32* dest, const u32* src)
@@ -84,6 +84,14 @@ static std::vector<u32> s_fastmem_virtual_mapping; // maps vaddr -> mainmem offs
 static std::unordered_multimap<u32, u32> s_fastmem_physical_mapping; // maps mainmem offset -> vaddr
 static std::unordered_map<uptr, LoadstoreBackpatchInfo> s_fastmem_backpatch_info;
 static std::unordered_set<u32> s_fastmem_faulting_pcs;
+static std::unordered_set<u32> s_fastmem_code_write_pcs;
+
+// Writable alias of EE main memory, used to complete stores to write-protected code pages
+// without lifting the protection (see vtlb_memWriteCodePage).
+static std::unique_ptr<SharedMemoryMappingArea> s_code_write_area;
+static u8* s_code_write_alias = nullptr;
+
+static void* vtlb_PrepareCodePageWrite(uptr ptr, u32 size);
 
 vtlb_private::VTLBPhysical vtlb_private::VTLBPhysical::fromPointer(sptr ptr)
 {
@@ -322,6 +330,46 @@ template void vtlb_memWrite<mem16_t>(u32 mem, mem16_t data);
 template void vtlb_memWrite<mem32_t>(u32 mem, mem32_t data);
 template void vtlb_memWrite<mem64_t>(u32 mem, mem64_t data);
 
+// Slow path for stores which faulted on a write-protected code page when sub-page SMC
+// tracking is enabled. Only the blocks overlapping the written lines are discarded.
+template <typename DataType>
+void vtlb_memWriteCodePage(u32 addr, DataType data)
+{
+	auto vmv = vtlbdata.vmap[addr >> VTLB_PAGE_BITS];
+
+	if (!vmv.isHandler(addr))
+	{
+		void* ptr = vtlb_PrepareCodePageWrite(vmv.assumePtr(addr), sizeof(DataType));
+		std::memcpy(ptr, &data, sizeof(DataType));
+	}
+	else
+	{
+		// TLB may have been remapped since the store was backpatched.
+		u32 paddr = vmv.assumeHandlerGetPAddr(addr);
+		vmv.assumeHandler<sizeof(DataType) * 8, true>()(paddr, data);
+	}
+}
+
+void TAKES_R128 vtlb_memWriteCodePage128(u32 mem, r128 value)
+{
+	auto vmv = vtlbdata.vmap[mem >> VTLB_PAGE_BITS];
+
+	if (!vmv.isHandler(mem))
+	{
+		r128_store_unaligned(vtlb_PrepareCodePageWrite(vmv.assumePtr(mem), sizeof(u128)), value);
+	}
+	else
+	{
+		u32 paddr = vmv.assumeHandlerGetPAddr(mem);
+		vmv.assumeHandler<128, true>()(paddr, value);
+	}
+}
+
+template void vtlb_memWriteCodePage<mem8_t>(u32 mem, mem8_t data);
+template void vtlb_memWriteCodePage<mem16_t>(u32 mem, mem16_t data);
+template void vtlb_memWriteCodePage<mem32_t>(u32 mem, mem32_t data);
+template void vtlb_memWriteCodePage<mem64_t>(u32 mem, mem64_t data);
+
 template <typename DataType>
 bool vtlb_ramRead(u32 addr, DataType* value)
 {
@@ -1093,6 +1141,7 @@ void vtlb_ClearLoadStoreInfo()
 {
 	s_fastmem_backpatch_info.clear();
 	s_fastmem_faulting_pcs.clear();
+	s_fastmem_code_write_pcs.clear();
 }
 
 void vtlb_AddLoadStoreInfo(uptr code_address, u32 code_size, u32 guest_pc, u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register, u8 size_in_bits, bool is_signed, bool is_load, bool is_fpr)
@@ -1107,7 +1156,7 @@ void vtlb_AddLoadStoreInfo(uptr code_address, u32 code_size, u32 guest_pc, u32 g
 	s_fastmem_backpatch_info.emplace(code_address, info);
 }
 
-bool vtlb_BackpatchLoadStore(uptr code_address, uptr fault_address)
+static bool vtlb_BackpatchLoadStore(uptr code_address, uptr fault_address, bool code_write)
 {
 	uptr fastmem_start = (uptr)vtlbdata.fastmem_base;
 	uptr fastmem_end = fastmem_start + 0xFFFFFFFFu;
@@ -1119,25 +1168,40 @@ bool vtlb_BackpatchLoadStore(uptr code_address, uptr fault_address)
 		return false;
 
 	const LoadstoreBackpatchInfo& info = iter->second;
+	if (code_write && info.is_load)
+		return false;
+
 	const u32 guest_addr = static_cast<u32>(fault_address - fastmem_start);
 	vtlb_DynBackpatchLoadStore(code_address, info.code_size, info.guest_pc, guest_addr,
 		info.gpr_bitmask, info.fpr_bitmask, info.address_register, info.data_register,
-		info.size_in_bits, info.is_signed, info.is_load, info.is_fpr);
+		info.size_in_bits, info.is_signed, info.is_load, info.is_fpr, code_write);
 
 	// queue block for recompilation later
 	Cpu->Clear(info.guest_pc, 1);
 
 	// and store the pc in the faulting list, so that we don't emit another fastmem loadstore
 	s_fastmem_faulting_pcs.insert(info.guest_pc);
+	if (code_write)
+		s_fastmem_code_write_pcs.insert(info.guest_pc);
 	s_fastmem_backpatch_info.erase(iter);
 	return true;
 }
 
+bool vtlb_BackpatchLoadStore(uptr code_address, uptr fault_address)
+{
+	return vtlb_BackpatchLoadStore(code_address, fault_address, false);
+}
+
 bool vtlb_IsFaultingPC(u32 guest_pc)
 {
 	return (s_fastmem_faulting_pcs.find(guest_pc) != s_fastmem_faulting_pcs.end());
 }
 
+bool vtlb_IsCodeWritePC(u32 guest_pc)
+{
+	return (s_fastmem_code_write_pcs.find(guest_pc) != s_fastmem_code_write_pcs.end());
+}
+
 //virtual mappings
 //TODO: Add invalid paddr checks
 void vtlb_VMap(u32 vaddr, u32 paddr, u32 size)
@@ -1265,6 +1329,9 @@ void vtlb_Init()
 	// The LUT is only used for 1 game so we allocate it only when the gamefix is enabled (save 4MB)
 	if (EmuConfig.Gamefixes.GoemonTlbHack)
 		vtlb_Alloc_Ppmap();
+
+	if (CHECK_SUBPAGE_SMC)
+		vtlb_Alloc_CodeWriteAlias();
 }
 
 // vtlb_Reset -- Performs a COP0-level reset of the PS2's TLB.
@@ -1294,6 +1361,9 @@ void vtlb_ResetFastmem()
 	if (!CHECK_FASTMEM || !CHECK_EEREC || !vtlbdata.vmap)
 		return;
 
+	if (CHECK_SUBPAGE_SMC)
+		vtlb_Alloc_CodeWriteAlias();
+
 	// we need to go through and look at the vtlb pointers, to remap the host area
 	for (size_t i = 0; i < VTLB_VMAP_ITEMS; i++)
 	{
@@ -1313,6 +1383,25 @@ void vtlb_ResetFastmem()
 	}
 }
 
+// The writable alias of EE RAM is only needed for sub-page SMC tracking, so it is mapped on
+// first use. If it can't be mapped, code writes fall back to whole-page protection.
+void vtlb_Alloc_CodeWriteAlias()
+{
+	if (s_code_write_alias)
+		return;
+
+	if (!s_code_write_area)
+		s_code_write_area = SharedMemoryMappingArea::Create(Ps2MemSize::TotalRam);
+	if (s_code_write_area)
+	{
+		s_code_write_alias = s_code_write_area->Map(SysMemory::GetDataFileHandle(), HostMemoryMap::EEmemOffset,
+			s_code_write_area->BasePointer(), Ps2MemSize::TotalRam, PageAccess_ReadWrite());
+	}
+
+	if (!s_code_write_alias)
+		Console.Warning("(vtlb) Failed to map code write alias, using whole-page SMC tracking.");
+}
+
 // Reserves the vtlb core allocation used by various emulation components!
 // [TODO] basemem - request allocating memory at the specified virtual location, which can allow
 //    for easier debugging and/or 3rd party cheat programs.  If 0, the operating system
@@ -1378,6 +1467,13 @@ void vtlb_Core_Free()
 	decltype(s_fastmem_physical_mapping)().swap(s_fastmem_physical_mapping);
 	decltype(s_fastmem_virtual_mapping)().swap(s_fastmem_virtual_mapping);
 	s_fastmem_area.reset();
+
+	if (s_code_write_alias)
+	{
+		s_code_write_area->Unmap(s_code_write_alias, Ps2MemSize::TotalRam);
+		s_code_write_alias = nullptr;
+	}
+	s_code_write_area.reset();
 }
 
 // ===========================================================================================
@@ -1405,6 +1501,13 @@ void vtlb_Core_Free()
 // is 4096 (4k), which is why you'll see a lot of 0xfff's, >><< 12's, and 0x1000's in the
 // code below.
 //
+// Sub-page tracking:
+// Each protected page also records which 128 byte lines hold recompiled code.  When the
+// sub-page SMC option is enabled, a fastmem store which faults on a protected page is
+// backpatched to vtlb_memWriteCodePage() instead of dropping the whole page to manual
+// protection.  The slow path only discards blocks overlapping the lines being written,
+// and completes the store through a writable alias, so the page stays protected.
+//
 
 struct vtlb_PageProtectionInfo
 {
@@ -1416,8 +1519,21 @@ struct vtlb_PageProtectionInfo
 	u32 ReverseRamMap;
 
 	vtlb_ProtectionMode Mode;
+
+	// One bit per 128 byte line which holds recompiled code. Only meaningful in ProtMode_Write.
+	u32 CodeLines;
 };
 
+static constexpr u32 CODE_LINE_SHIFT = 7;
+static_assert((__pagesize >> CODE_LINE_SHIFT) == 32, "Code line mask must cover a page");
+
+static __fi u32 mmap_GetCodeLineMask(u32 page_offset, u32 size)
+{
+	const u32 first = page_offset >> CODE_LINE_SHIFT;
+	const u32 last = (page_offset + size - 1) >> CODE_LINE_SHIFT;
+	return ((last == 31) ? 0xFFFFFFFFu : ((1u << (last + 1)) - 1)) & ~((1u << first) - 1);
+}
+
 alignas(16) static vtlb_PageProtectionInfo m_PageProtectInfo[Ps2MemSize::TotalRam >> __pageshift];
 
 
@@ -1470,6 +1586,50 @@ void mmap_MarkCountedRamPage(u32 paddr)
 	vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadOnly());
 }
 
+// paddr - physically mapped PS2 address, size - in bytes
+// Records that [paddr, paddr+size) holds recompiled code. The range must not cross a page.
+void mmap_MarkCodeLines(u32 paddr, u32 size)
+{
+	pxAssert(eeMem);
+	pxAssert(size > 0 && ((paddr & __pagemask) + size) <= __pagesize);
+
+	uptr ptr = (uptr)PSM(paddr);
+	uptr offset = ptr - (uptr)eeMem->Main;
+	if (!ptr || offset >= Ps2MemSize::ExposedRam)
+		return;
+
+	m_PageProtectInfo[offset >> __pageshift].CodeLines |= mmap_GetCodeLineMask(paddr & __pagemask, size);
+}
+
+// ptr - host pointer the store would normally go to.
+// Returns the pointer the store should be performed through.
+static void* vtlb_PrepareCodePageWrite(uptr ptr, u32 size)
+{
+	const uptr offset = ptr - (uptr)eeMem->Main;
+	if (offset >= Ps2MemSize::ExposedRam)
+		return reinterpret_cast<void*>(ptr);
+
+	vtlb_PageProtectionInfo& info = m_PageProtectInfo[offset >> __pageshift];
+	if (info.Mode != ProtMode_Write)
+		return reinterpret_cast<void*>(ptr);
+
+	const u32 page_offset = static_cast<u32>(offset & __pagemask);
+	const u32 mask = mmap_GetCodeLineMask(page_offset, size);
+	if (info.CodeLines & mask)
+	{
+		const u32 first = page_offset >> CODE_LINE_SHIFT;
+		const u32 last = (page_offset + size - 1) >> CODE_LINE_SHIFT;
+		eeRecPerfLog.Write("Clearing code lines %u-%u in protected page @ 0x%05x",
+			first, last, info.ReverseRamMap >> __pageshift);
+
+		// Any block overlapping these lines goes away, so the bits can be dropped as well.
+		info.CodeLines &= ~mask;
+		Cpu->Clear(info.ReverseRamMap + (first << CODE_LINE_SHIFT), ((last - first + 1) << CODE_LINE_SHIFT) / 4);
+	}
+
+	return s_code_write_alias + offset;
+}
+
 // offset - offset of address relative to psM.
 // All recompiled blocks belonging to the page are cleared, and any new blocks recompiled
 // from code residing in this page will use manual protection.
@@ -1487,6 +1647,7 @@ static __fi void mmap_ClearCpuBlock(uint offset)
 	HostSys::MemProtect(&eeMem->Main[rampage << __pageshift], __pagesize, PageAccess_ReadWrite());
 	vtlb_UpdateFastmemProtection(rampage << __pageshift, __pagesize, PageAccess_ReadWrite());
 	m_PageProtectInfo[rampage].Mode = ProtMode_Manual;
+	m_PageProtectInfo[rampage].CodeLines = 0;
 	Cpu->Clear(m_PageProtectInfo[rampage].ReverseRamMap, __pagesize);
 }
 
@@ -1504,6 +1665,13 @@ PageFaultHandler::HandlerResult PageFaultHandler::HandlePageFault(void* exceptio
 		uptr offset = (ptr - (uptr)eeMem->Main);
 		if (ptr && m_PageProtectInfo[offset >> __pageshift].Mode == ProtMode_Write)
 		{
+			// With sub-page tracking, route the store through the checked slow path instead.
+			if (CHECK_SUBPAGE_SMC && s_code_write_alias && vtlb_BackpatchLoadStore(reinterpret_cast<uptr>(exception_pc),
+										 reinterpret_cast<uptr>(fault_address), true))
+			{
+				return HandlerResult::ContinueExecution;
+			}
+
 			// fprintf(stderr, "Not backpatching code write at %08X\n", vaddr);
 			mmap_ClearCpuBlock(offset);
 			return HandlerResult::ContinueExecution;
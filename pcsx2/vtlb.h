@@ -42,6 +42,7 @@ typedef u32 vtlbHandler;
 extern bool vtlb_Core_Alloc();
 extern void vtlb_Core_Free();
 extern void vtlb_Alloc_Ppmap();
+extern void vtlb_Alloc_CodeWriteAlias();
 extern void vtlb_Init();
 extern void vtlb_Shutdown();
 extern void vtlb_Reset();
@@ -78,8 +79,9 @@ extern bool vtlb_BackpatchLoadStore(uptr code_address, uptr fault_address);
 
 extern void vtlb_ClearLoadStoreInfo();
 extern void vtlb_AddLoadStoreInfo(uptr code_address, u32 code_size, u32 guest_pc, u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register, u8 size_in_bits, bool is_signed, bool is_load, bool is_fpr);
-extern void vtlb_DynBackpatchLoadStore(uptr code_address, u32 code_size, u32 guest_pc, u32 guest_addr, u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register, u8 size_in_bits, bool is_signed, bool is_load, bool is_fpr);
+extern void vtlb_DynBackpatchLoadStore(uptr code_address, u32 code_size, u32 guest_pc, u32 guest_addr, u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register, u8 size_in_bits, bool is_signed, bool is_load, bool is_fpr, bool is_code_write);
 extern bool vtlb_IsFaultingPC(u32 guest_pc);
+extern bool vtlb_IsCodeWritePC(u32 guest_pc);
 
 //Memory functions
 
@@ -91,6 +93,11 @@ template< typename DataType >
 extern void vtlb_memWrite(u32 mem, DataType value);
 extern void TAKES_R128 vtlb_memWrite128(u32 mem, r128 value);
 
+// Stores to pages holding recompiled code, used by backpatched stores under sub-page SMC tracking.
+template< typename DataType >
+extern void vtlb_memWriteCodePage(u32 mem, DataType value);
+extern void TAKES_R128 vtlb_memWriteCodePage128(u32 mem, r128 value);
+
 // "Safe" variants of vtlb, designed for external tools.
 // These routines only access the various RAM, and will not call handlers
 // which has the potential to change hardware state.
@@ -230,6 +237,7 @@ enum vtlb_ProtectionMode
 
 extern vtlb_ProtectionMode mmap_GetRamPageInfo(u32 paddr);
 extern void mmap_MarkCountedRamPage(u32 paddr);
+extern void mmap_MarkCodeLines(u32 paddr, u32 size);
 extern void mmap_ResetBlockTracking();
 
 // --------------------------------------------------------------------------------------
@@ -3,11 +3,128 @@
 
 #include "BaseblockEx.h"
 
+BaseBlockLinks::BaseBlockLinks()
+{
+	Rehash(INITIAL_BUCKETS);
+}
+
+void BaseBlockLinks::Rehash(u32 new_size)
+{
+	pxAssert((new_size & (new_size - 1)) == 0);
+
+	std::vector<Bucket> old_buckets(new_size, Bucket{EMPTY_PC, END_OF_CHAIN});
+	old_buckets.swap(m_buckets);
+	m_mask = new_size - 1;
+
+	for (const Bucket& bucket : old_buckets)
+	{
+		if (bucket.pc == EMPTY_PC)
+			continue;
+
+		u32 i = Hash(bucket.pc) & m_mask;
+		while (m_buckets[i].pc != EMPTY_PC)
+			i = (i + 1) & m_mask;
+		m_buckets[i] = bucket;
+	}
+}
+
+void BaseBlockLinks::Insert(u32 pc, uptr jumpptr)
+{
+	pxAssert(pc != EMPTY_PC);
+
+	// Keep the load factor under 50% so probe sequences stay short.
+	if ((m_used + 1) * 2 > m_buckets.size())
+		Rehash(static_cast<u32>(m_buckets.size()) * 2);
+
+	u32 i = Hash(pc) & m_mask;
+	while (m_buckets[i].pc != pc && m_buckets[i].pc != EMPTY_PC)
+		i = (i + 1) & m_mask;
+
+	Bucket& bucket = m_buckets[i];
+	if (bucket.pc == EMPTY_PC)
+	{
+		bucket.pc = pc;
+		bucket.head = END_OF_CHAIN;
+		m_used++;
+	}
+
+	const u32 node = static_cast<u32>(m_nodes.size());
+	m_nodes.push_back(Node{jumpptr, bucket.head});
+	bucket.head = node;
+}
+
+void BaseBlockLinks::Clear()
+{
+	// Only clear the entries, keep the capacity which was needed last time around.
+	std::fill(m_buckets.begin(), m_buckets.end(), Bucket{EMPTY_PC, END_OF_CHAIN});
+	m_nodes.clear();
+	m_used = 0;
+}
+
+BaseBlockIntervals::BaseBlockIntervals()
+{
+	Rehash(INITIAL_BUCKETS);
+}
+
+void BaseBlockIntervals::Rehash(u32 new_size)
+{
+	pxAssert((new_size & (new_size - 1)) == 0);
+
+	std::vector<Bucket> old_buckets(new_size, Bucket{EMPTY_CHUNK, 0});
+	old_buckets.swap(m_buckets);
+	m_mask = new_size - 1;
+
+	for (const Bucket& bucket : old_buckets)
+	{
+		if (bucket.chunk == EMPTY_CHUNK)
+			continue;
+
+		u32 i = Hash(bucket.chunk) & m_mask;
+		while (m_buckets[i].chunk != EMPTY_CHUNK)
+			i = (i + 1) & m_mask;
+		m_buckets[i] = bucket;
+	}
+}
+
+void BaseBlockIntervals::Add(u32 start, u32 end)
+{
+	const u32 first_chunk = start >> CHUNK_SHIFT;
+	const u32 last_chunk = (std::max(end, start + 4) - 1) >> CHUNK_SHIFT;
+	for (u32 chunk = first_chunk; chunk <= last_chunk; chunk++)
+	{
+		// Same load factor as the link table.
+		if ((m_used + 1) * 2 > m_buckets.size())
+			Rehash(static_cast<u32>(m_buckets.size()) * 2);
+
+		u32 i = Hash(chunk) & m_mask;
+		while (m_buckets[i].chunk != chunk && m_buckets[i].chunk != EMPTY_CHUNK)
+			i = (i + 1) & m_mask;
+
+		Bucket& bucket = m_buckets[i];
+		if (bucket.chunk == EMPTY_CHUNK)
+		{
+			bucket.chunk = chunk;
+			bucket.lowest_start = start;
+			m_used++;
+		}
+		else
+		{
+			bucket.lowest_start = std::min(bucket.lowest_start, start);
+		}
+	}
+}
+
+void BaseBlockIntervals::Clear()
+{
+	std::fill(m_buckets.begin(), m_buckets.end(), Bucket{EMPTY_CHUNK, 0});
+	m_used = 0;
+}
+
 BASEBLOCKEX* BaseBlocks::New(u32 startpc, uptr fnptr)
 {
-	std::pair<linkiter_t, linkiter_t> range = links.equal_range(startpc);
-	for (linkiter_t i = range.first; i != range.second; ++i)
-		*(u32*)i->second = fnptr - (i->second + 4);
+	links.ForEach(startpc, [fnptr](uptr jumpptr) {
+		*(u32*)jumpptr = fnptr - (jumpptr + 4);
+	});
 
 	return blocks.insert(startpc, fnptr);
 }
@@ -64,5 +181,5 @@ void BaseBlocks::Link(u32 pc, s32* jumpptr)
 		*jumpptr = (s32)(targetblock->fnptr - (sptr)(jumpptr + 1));
 	else
 		*jumpptr = (s32)(recompiler - (sptr)(jumpptr + 1));
-	links.insert(std::pair<u32, uptr>(pc, (uptr)jumpptr));
+	links.Insert(pc, (uptr)jumpptr);
 }
@@ -3,8 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
-#include <map>
+#include <vector>
 
 #include "common/Assertions.h"
 
@@ -138,13 +139,134 @@ public:
 	}
 };
 
+// Tracks every x86 jump site which targets a given guest PC, so the jumps can be
+// repointed when the target block is compiled or cleared. Sites are kept in a flat
+// node pool, chained per PC, with an open-addressed (linear probing) table holding
+// the head of each chain. Nothing is erased until Clear(), same as the old multimap.
+class BaseBlockLinks
+{
+	static constexpr u32 EMPTY_PC = 0xFFFFFFFFu;
+	static constexpr u32 END_OF_CHAIN = 0xFFFFFFFFu;
+	static constexpr u32 INITIAL_BUCKETS = 0x4000;
+
+	struct Bucket
+	{
+		u32 pc;
+		u32 head;
+	};
+
+	struct Node
+	{
+		uptr jumpptr;
+		u32 next;
+	};
+
+	std::vector<Bucket> m_buckets;
+	std::vector<Node> m_nodes;
+	u32 m_mask = 0;
+	u32 m_used = 0;
+
+	static __fi u32 Hash(u32 pc)
+	{
+		// Fibonacci hashing; the low two bits of a PC are always zero.
+		return (pc >> 2) * 0x9E3779B1u;
+	}
+
+	__fi const Bucket* Find(u32 pc) const
+	{
+		if (m_used == 0)
+			return nullptr;
+
+		for (u32 i = Hash(pc) & m_mask;; i = (i + 1) & m_mask)
+		{
+			const Bucket& bucket = m_buckets[i];
+			if (bucket.pc == pc)
+				return &bucket;
+			if (bucket.pc == EMPTY_PC)
+				return nullptr;
+		}
+	}
+
+	void Rehash(u32 new_size);
+
+public:
+	BaseBlockLinks();
+
+	void Insert(u32 pc, uptr jumpptr);
+	void Clear();
+
+	__fi u32 NodeCount() const { return static_cast<u32>(m_nodes.size()); }
+
+	template <typename F>
+	__fi void ForEach(u32 pc, const F& func) const
+	{
+		const Bucket* bucket = Find(pc);
+		if (!bucket)
+			return;
+
+		for (u32 i = bucket->head; i != END_OF_CHAIN; i = m_nodes[i].next)
+			func(m_nodes[i].jumpptr);
+	}
+};
+
+// Interval index for range clears. For each 4KB chunk of guest memory, keeps the lowest start PC
+// of any block compiled since the last reset which reaches into it. Blocks are only sorted by
+// start PC, so this bounds how far back a query has to look, and one long block doesn't slow
+// down clears everywhere else. Entries are only lowered until Clear(), so removed blocks just
+// leave a conservative bound behind.
+class BaseBlockIntervals
+{
+	static constexpr u32 CHUNK_SHIFT = 12;
+	static constexpr u32 EMPTY_CHUNK = 0xFFFFFFFFu;
+	static constexpr u32 INITIAL_BUCKETS = 0x1000;
+
+	struct Bucket
+	{
+		u32 chunk;
+		u32 lowest_start;
+	};
+
+	std::vector<Bucket> m_buckets;
+	u32 m_mask = 0;
+	u32 m_used = 0;
+
+	static __fi u32 Hash(u32 chunk)
+	{
+		return chunk * 0x9E3779B1u;
+	}
+
+	void Rehash(u32 new_size);
+
+public:
+	BaseBlockIntervals();
+
+	/// Records a block covering [start, end).
+	void Add(u32 start, u32 end);
+	void Clear();
+
+	/// Returns the lowest start PC of any block which can overlap addr, or addr if none can.
+	__fi u32 LowestStart(u32 addr) const
+	{
+		if (m_used == 0)
+			return addr;
+
+		const u32 chunk = addr >> CHUNK_SHIFT;
+		for (u32 i = Hash(chunk) & m_mask;; i = (i + 1) & m_mask)
+		{
+			const Bucket& bucket = m_buckets[i];
+			if (bucket.chunk == chunk)
+				return std::min(bucket.lowest_start, addr);
+			if (bucket.chunk == EMPTY_CHUNK)
+				return addr;
+		}
+	}
+};
+
 class BaseBlocks
 {
 protected:
-	typedef std::multimap<u32, uptr>::iterator linkiter_t;
-
-	// switch to a hash map later?
-	std::multimap<u32, uptr> links;
+	BaseBlockLinks links;
+	BaseBlockIntervals intervals;
 	uptr recompiler;
 	BaseBlockArray blocks;
 
@@ -164,6 +286,19 @@ public:
 	int LastIndex(u32 startpc) const;
 	//BASEBLOCKEX* GetByX86(uptr ip);
 
+	__fi void SetSize(BASEBLOCKEX* block, u32 size)
+	{
+		block->size = size;
+		intervals.Add(block->startpc, block->startpc + size * 4);
+	}
+
+	/// Returns the index of the first block which could overlap a range starting at addr,
+	/// or 0 if no block starts at or below it. Callers walk forward until startpc passes the range end.
+	__fi int FirstIndexOverlapping(u32 addr) const
+	{
+		return std::max(LastIndex(intervals.LowestStart(addr)), 0);
+	}
+
 	__fi int Index(u32 startpc) const
 	{
 		int idx = LastIndex(startpc);
@@ -196,10 +331,9 @@ public:
 		{
 			pxAssert(idx <= last);
 
-			//u32 startpc = blocks[idx].startpc;
-			std::pair<linkiter_t, linkiter_t> range = links.equal_range(blocks[idx].startpc);
-			for (linkiter_t i = range.first; i != range.second; ++i)
-				*(u32*)i->second = recompiler - (i->second + 4);
+			links.ForEach(blocks[idx].startpc, [this](uptr jumpptr) {
+				*(u32*)jumpptr = recompiler - (jumpptr + 4);
+			});
 
 			if (IsDevBuild)
 			{
@@ -222,7 +356,8 @@ public:
 	__fi void Reset()
 	{
 		blocks.clear();
-		links.clear();
+		links.Clear();
+		intervals.Clear();
 	}
 };
 
@@ -425,10 +425,10 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 	nVifStruct& v = nVif[idx];
 
 	// Check size before the compilation
-	if (v.recWritePtr >= v.recEndPtr)
+	if (v.recWritePtr >= v.recEndPtr || v.vifBlocks.full())
 	{
-		DevCon.WriteLn("nVif Recompiler Cache Reset! [0x%016" PRIXPTR " > 0x%016" PRIXPTR "]",
-			v.recWritePtr, v.recEndPtr);
+		DevCon.WriteLn("nVif Recompiler Cache Reset! [0x%016" PRIXPTR " > 0x%016" PRIXPTR "] [%u blocks]",
+			v.recWritePtr, v.recEndPtr, v.vifBlocks.size());
 		dVifReset(idx);
 	}
 
@@ -438,14 +438,14 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 
 	block.startPtr = (uptr)xGetAlignedCallTarget();
 	block.length = dVifComputeLength(block.cl, block.wl, block.num, isFill);
-	v.vifBlocks.add(block);
+	nVifBlock* added = v.vifBlocks.add(block);
 
 	VifUnpackSSE_Dynarec(v, block).CompileRoutine();
 
 	Perf::vif.RegisterPC(v.recWritePtr, xGetPtr() - v.recWritePtr, block.upkType /* FIXME ideally a key*/);
 	v.recWritePtr = xGetPtr();
 
-	return &block;
+	return added;
 }
 
 _vifT __fi void dVifUnpack(const u8* data, bool isFill)
@@ -1088,9 +1088,11 @@ static __fi u32 psxRecClearMem(u32 pc)
 		recBlocks.Remove(toRemoveFirst, (blockidx - 1));
 	}
 
-	blockidx = 0;
+	blockidx = recBlocks.FirstIndexOverlapping(pc);
 	while (BASEBLOCKEX* pexblock = recBlocks[blockidx++])
 	{
+		if (pexblock->startpc > pc)
+			break;
 		if (pc >= pexblock->startpc && pc < pexblock->startpc + pexblock->size * 4) [[unlikely]]
 		{
 			DevCon.Error("[IOP] Impossible block clearing failure");
@@ -1110,6 +1112,14 @@ static __fi void recClearIOP(u32 Addr, u32 Size)
 		pc += PSXREC_CLEARM(pc);
 }
 
+void psxRecEmitRAMCodeTest()
+{
+	xMOV(eax, arg1regd);
+	xSHR(eax, 2);
+	xMOV(rax, ptrNative[xComplexAddress(arg3reg, recRAM, rax * sizeof(BASEBLOCK))]);
+	xCMP(rax, ptrNative[&iopJITCompile]);
+}
+
 void psxSetBranchReg()
 {
 	psxbranch = 1;
@@ -1766,7 +1776,7 @@ StartRecomp:
 	}
 
 	pxAssert((psxpc - startpc) >> 2 <= 0xffff);
-	s_pCurBlockEx->size = (psxpc - startpc) >> 2;
+	recBlocks.SetSize(s_pCurBlockEx, (psxpc - startpc) >> 2);
 
 	if (!(psxpc & 0x10000000))
 		g_psxMaxRecMem = std::max((psxpc & ~0xa0000000), g_psxMaxRecMem);
@@ -45,6 +45,11 @@ extern void psxSetBranchReg();
 extern void psxSetBranchImm(u32 imm);
 extern void psxRecompileNextInstruction(bool delayslot, bool swapped_delayslot);
 
+// Compares the block for the IOP RAM offset in arg1reg against the JIT compile stub, so
+// inline stores can skip the code clear. ZF is set when the word holds no code.
+// Clobbers rax and arg3reg.
+extern void psxRecEmitRAMCodeTest();
+
 ////////////////////////////////////////////////////////////////////
 // IOP Constant Propagation Defines, Vars, and API - From here down!
 
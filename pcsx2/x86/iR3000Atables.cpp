@@ -7,6 +7,7 @@
 #include "IopMem.h"
 #include "IopDma.h"
 #include "IopGte.h"
+#include "Config.h"
 
 #include "common/Console.h"
 
@@ -1075,8 +1076,126 @@ static void rpsxCalcStoreOperand()
 		xMOV(arg2regd, ptr32[&psxRegs.GPR.r[_Rt_]]);
 }
 
+// Calls a memory handler without giving up the guest registers cached in caller-saved
+// host registers. They are spilled around the call instead, so the inline RAM path next
+// to it can keep using them.
+static void rpsxCallMemHandler(const void* func)
+{
+	static constexpr u32 GPR_SIZE = 8;
+
+	// on win32, we need to reserve an additional 32 bytes shadow space when calling out to C
+#ifdef _WIN32
+	static constexpr u32 SHADOW_SIZE = 32;
+#else
+	static constexpr u32 SHADOW_SIZE = 0;
+#endif
+
+	u32 num_gprs = 0;
+	for (u32 i = 0; i < iREGCNT_GPR; i++)
+	{
+		if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+			num_gprs++;
+	}
+
+	const u32 stack_size = (((num_gprs + 1) & ~1u) * GPR_SIZE) + SHADOW_SIZE;
+	if (stack_size > 0)
+	{
+		xSUB(rsp, stack_size);
+
+		u32 stack_offset = SHADOW_SIZE;
+		for (u32 i = 0; i < iREGCNT_GPR; i++)
+		{
+			if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+			{
+				xMOV(ptr64[rsp + stack_offset], xRegister64(i));
+				stack_offset += GPR_SIZE;
+			}
+		}
+	}
+
+	xFastCall(func);
+
+	if (stack_size > 0)
+	{
+		u32 stack_offset = SHADOW_SIZE;
+		for (u32 i = 0; i < iREGCNT_GPR; i++)
+		{
+			if (x86regs[i].inuse && xRegisterBase::IsCallerSaved(i))
+			{
+				xMOV(xRegister64(i), ptr64[rsp + stack_offset]);
+				stack_offset += GPR_SIZE;
+			}
+		}
+
+		xADD(rsp, stack_size);
+	}
+}
+
+static void rpsxLoadExtend(int size, bool sign, const xRegister32& dreg)
+{
+	// sign/zero extend as needed
+	switch (size)
+	{
+		case 8:
+			sign ? xMOVSX(dreg, al) : xMOVZX(dreg, al);
+			break;
+		case 16:
+			sign ? xMOVSX(dreg, ax) : xMOVZX(dreg, ax);
+			break;
+		case 32:
+			xMOV(dreg, eax);
+			break;
+			jNO_DEFAULT
+	}
+}
+
+// RAM reads have no side effects, so a load from a constant RAM address is just a move.
+static bool rpsxLoadConstRAM(int size, bool sign)
+{
+	if (!PSX_IS_CONST1(_Rs_))
+		return false;
+
+	const u32 addr = g_psxConstRegs[_Rs_] + _Imm_;
+	if (addr & 0x10000000)
+		return false;
+
+	if (_Rt_ == 0)
+		return true;
+
+	PSX_DEL_CONST(_Rt_);
+	_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
+
+	const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
+	if (rt < 0)
+		_freeX86reg(eax);
+
+	const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
+	u8* ptr = iopPhysMem(addr);
+	switch (size)
+	{
+		case 8:
+			sign ? xMOVSX(dreg, ptr8[ptr]) : xMOVZX(dreg, ptr8[ptr]);
+			break;
+		case 16:
+			sign ? xMOVSX(dreg, ptr16[(u16*)ptr]) : xMOVZX(dreg, ptr16[(u16*)ptr]);
+			break;
+		case 32:
+			xMOV(dreg, ptr32[(u32*)ptr]);
+			break;
+			jNO_DEFAULT
+	}
+
+	if (rt < 0)
+		xMOV(ptr32[&psxRegs.GPR.r[_Rt_]], eax);
+
+	return true;
+}
+
 static void rpsxLoad(int size, bool sign)
 {
+	if (rpsxLoadConstRAM(size, sign))
+		return;
+
 	rpsxCalcAddressOperand();
 
 	if (_Rt_ != 0)
@@ -1085,20 +1204,21 @@ static void rpsxLoad(int size, bool sign)
 		_deletePSXtoX86reg(_Rt_, DELETE_REG_FREE_NO_WRITEBACK);
 	}
 
-	_psxFlushCall(FLUSH_FULLVTLB);
+	// The RAM path doesn't call out, so only the result register has to be free.
+	_freeX86reg(eax);
 	xTEST(arg1regd, 0x10000000);
 	xForwardJZ8 is_ram_read;
 
 	switch (size)
 	{
 		case 8:
-			xFastCall((void*)iopMemRead8);
+			rpsxCallMemHandler((void*)iopMemRead8);
 			break;
 		case 16:
-			xFastCall((void*)iopMemRead16);
+			rpsxCallMemHandler((void*)iopMemRead16);
 			break;
 		case 32:
-			xFastCall((void*)iopMemRead32);
+			rpsxCallMemHandler((void*)iopMemRead32);
 			break;
 
 			jNO_DEFAULT
@@ -1136,22 +1256,7 @@ static void rpsxLoad(int size, bool sign)
 	done.SetTarget();
 
 	const int rt = rpsxAllocRegIfUsed(_Rt_, MODE_WRITE);
-	const xRegister32 dreg((rt < 0) ? eax.GetId() : rt);
-
-	// sign/zero extend as needed
-	switch (size)
-	{
-		case 8:
-			sign ? xMOVSX(dreg, al) : xMOVZX(dreg, al);
-			break;
-		case 16:
-			sign ? xMOVSX(dreg, ax) : xMOVZX(dreg, ax);
-			break;
-		case 32:
-			xMOV(dreg, eax);
-			break;
-			jNO_DEFAULT
-	}
+	rpsxLoadExtend(size, sign, xRegister32((rt < 0) ? eax.GetId() : rt));
 
 	// if not caching, write back
 	if (rt < 0)
@@ -1189,20 +1294,83 @@ static void rpsxLW()
 	rpsxLoad(32, false);
 }
 
-static void rpsxSB()
+static void rpsxStore(int size)
 {
 	rpsxCalcAddressOperand();
 	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite8);
+
+	const void* handler;
+	switch (size)
+	{
+		case 8:
+			handler = (void*)iopMemWrite8;
+			break;
+		case 16:
+			handler = (void*)iopMemWrite16;
+			break;
+		case 32:
+			handler = (void*)iopMemWrite32;
+			break;
+
+			jNO_DEFAULT
+	}
+
+	if (!EmuConfig.Cpu.Recompiler.EnableFastmem)
+	{
+		rpsxCallMemHandler(handler);
+		return;
+	}
+
+	// Main RAM and its kseg mirrors are written inline, everything else (hardware registers,
+	// SIF, BIOS, and stores with the cache isolated) still goes through iopMemWrite.
+	_freeX86reg(eax);
+	_freeX86reg(arg3reg.GetId());
+	xTEST(arg1regd, 0x1f800000);
+	xForwardJNZ32 not_ram;
+	xTEST(ptr32[&psxRegs.CP0.n.Status], 0x10000);
+	xForwardJNZ32 cache_isolated;
+
+	xAND(arg1regd, Ps2MemSize::ExposedIopRam - 1);
+	auto addr = xComplexAddress(rax, iopMem->Main, arg1reg);
+	switch (size)
+	{
+		case 8:
+			xMOV(ptr8[addr], xRegister8(arg2regd));
+			break;
+		case 16:
+			xMOV(ptr16[addr], xRegister16(arg2regd));
+			break;
+		case 32:
+			xMOV(ptr32[addr], arg2regd);
+			break;
+
+			jNO_DEFAULT
+	}
+
+	// Only call out to clear the recompiler when the word actually holds code.
+	psxRecEmitRAMCodeTest();
+	xForwardJE32 no_code;
+	xAND(arg1regd, ~3);
+	xMOV(arg2regd, 1);
+	rpsxCallMemHandler((void*)psxRec.Clear);
+	xForwardJump32 done;
+
+	not_ram.SetTarget();
+	cache_isolated.SetTarget();
+	rpsxCallMemHandler(handler);
+
+	no_code.SetTarget();
+	done.SetTarget();
+}
+
+static void rpsxSB()
+{
+	rpsxStore(8);
 }
 
 static void rpsxSH()
 {
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite16);
+	rpsxStore(16);
 }
 
 static void rpsxSW()
@@ -1215,10 +1383,7 @@ static void rpsxSW()
 		return;
 	}
 
-	rpsxCalcAddressOperand();
-	rpsxCalcStoreOperand();
-	_psxFlushCall(FLUSH_FULLVTLB);
-	xFastCall((void*)iopMemWrite32);
+	rpsxStore(32);
 }
 
 //// SLL
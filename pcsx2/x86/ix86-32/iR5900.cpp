@@ -8,6 +8,7 @@
 #include "GS.h"
 #include "Host.h"
 #include "Memory.h"
+#include "MTVU0.h"
 #include "Patch.h"
 #include "R3000A.h"
 #include "R5900OpcodeTables.h"
@@ -823,8 +824,10 @@ void recClear(u32 addr, u32 size)
 
 	upperextent = std::min(upperextent, ceiling);
 
-	for (int i = 0; (pexblock = recBlocks[i]); i++)
+	for (int i = recBlocks.FirstIndexOverlapping(addr); (pexblock = recBlocks[i]); i++)
 	{
+		if (pexblock->startpc >= addr + size * 4)
+			break;
 		if (s_pCurBlock == PC_GETBLOCK(pexblock->startpc))
 			continue;
 		u32 blockend = pexblock->startpc + pexblock->size * 4;
@@ -2023,6 +2026,7 @@ static void memory_protect_recompiled_code(u32 startpc, u32 size)
 		case ProtMode_None:
 		case ProtMode_Write:
 			mmap_MarkCountedRamPage(inpage_ptr);
+			mmap_MarkCodeLines(inpage_ptr, inpage_sz);
 			manual_page[inpage_ptr >> 12] = 0;
 			break;
 
@@ -2176,6 +2180,10 @@ static void recRecompile(const u32 startpc)
 		recResetRaw();
 	}
 
+	// COP2 macro ops are compiled with microVU0's allocator and IR state.
+	if (vu0Thread.IsPending())
+		vu0Thread.WaitIdle();
+
 	xSetTextPtr(R5900_TEXTPTR);
 	xSetPtr(recPtr);
 	recPtr = xGetAlignedCallTarget();
@@ -2631,7 +2639,7 @@ StartRecomp:
 	}
 
 	pxAssert((pc - startpc) >> 2 <= 0xffff);
-	s_pCurBlockEx->size = (pc - startpc) >> 2;
+	recBlocks.SetSize(s_pCurBlockEx, (pc - startpc) >> 2);
 
 	if (HWADDR(pc) <= Ps2MemSize::ExposedRam)
 	{
@@ -121,7 +121,7 @@ namespace vtlb_private
 	// ------------------------------------------------------------------------
 	// Prepares eax and ecx for Direct or Indirect operations.
 	//
-	static void DynGen_PrepRegs(int addr_reg, int value_reg, u32 sz, bool xmm)
+	static void DynGen_PrepArgs(int addr_reg, int value_reg, u32 sz, bool xmm)
 	{
 		_freeX86reg(arg1regd);
 		EE::Profiler.EmitMem(addr_reg);
@@ -148,6 +148,11 @@ namespace vtlb_private
 				xMOV(arg2reg, xRegister64(value_reg));
 			}
 		}
+	}
+
+	static void DynGen_PrepRegs(int addr_reg, int value_reg, u32 sz, bool xmm)
+	{
+		DynGen_PrepArgs(addr_reg, value_reg, sz, xmm);
 
 		xMOV(eax, arg1regd);
 		xSHR(eax, VTLB_PAGE_BITS);
@@ -195,6 +200,37 @@ namespace vtlb_private
 		}
 	}
 
+	// ------------------------------------------------------------------------
+	// Calls the checked store for pages which hold recompiled code.
+	// In: arg1reg: guest address, arg2reg/xmm arg 1: data
+	static void DynGen_CodePageWrite(u32 bits)
+	{
+		switch (bits)
+		{
+			case 8:
+				xFastCall((void*)vtlb_memWriteCodePage<mem8_t>);
+				break;
+
+			case 16:
+				xFastCall((void*)vtlb_memWriteCodePage<mem16_t>);
+				break;
+
+			case 32:
+				xFastCall((void*)vtlb_memWriteCodePage<mem32_t>);
+				break;
+
+			case 64:
+				xFastCall((void*)vtlb_memWriteCodePage<mem64_t>);
+				break;
+
+			case 128:
+				xFastCall((void*)vtlb_memWriteCodePage128);
+				break;
+
+			jNO_DEFAULT
+		}
+	}
+
 	// ------------------------------------------------------------------------
 	static void DynGen_DirectWrite(u32 bits)
 	{
@@ -685,6 +721,13 @@ void vtlb_DynGenWrite(u32 sz, bool xmm, int addr_reg, int value_reg)
 	{
 		iFlushCall(FLUSH_FULLVTLB);
 
+		if (vtlb_IsCodeWritePC(pc))
+		{
+			DynGen_PrepArgs(addr_reg, value_reg, sz, xmm);
+			DynGen_CodePageWrite(sz);
+			return;
+		}
+
 		DynGen_PrepRegs(addr_reg, value_reg, sz, xmm);
 		DynGen_HandlerTest([sz]() { DynGen_DirectWrite(sz); }, 1, sz);
 		return;
@@ -916,7 +959,7 @@ void vtlb_DynV2P()
 
 void vtlb_DynBackpatchLoadStore(uptr code_address, u32 code_size, u32 guest_pc, u32 guest_addr,
 	u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register,
-	u8 size_in_bits, bool is_signed, bool is_load, bool is_xmm)
+	u8 size_in_bits, bool is_signed, bool is_load, bool is_xmm, bool is_code_write)
 {
 	static constexpr u32 GPR_SIZE = 8;
 	static constexpr u32 XMM_SIZE = 16;
@@ -1028,8 +1071,16 @@ void vtlb_DynBackpatchLoadStore(uptr code_address, u32 code_size, u32 guest_pc,
 			}
 		}
 
-		DynGen_PrepRegs(address_register, data_register, size_in_bits, is_xmm);
-		DynGen_HandlerTest([size_in_bits]() { DynGen_DirectWrite(size_in_bits); }, 1, size_in_bits);
+		if (is_code_write)
+		{
+			DynGen_PrepArgs(address_register, data_register, size_in_bits, is_xmm);
+			DynGen_CodePageWrite(size_in_bits);
+		}
+		else
+		{
+			DynGen_PrepRegs(address_register, data_register, size_in_bits, is_xmm);
+			DynGen_HandlerTest([size_in_bits]() { DynGen_DirectWrite(size_in_bits); }, 1, size_in_bits);
+		}
 	}
 
 	// restore regs
@@ -6,6 +6,7 @@
 #include "common/AlignedMalloc.h"
 #include "common/Perf.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 
 //------------------------------------------------------------------
 // Micro VU - Main Functions
@@ -54,12 +55,45 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	memset(&mVU.prog.lpState, 0, sizeof(mVU.prog.lpState));
 	mVU.profiler.Reset(mVU.index);
 
+	// Hand this session's programs to the on-disk cache before they're deleted below.
+	// Stored programs are only replayed after a full reset, not when the rec-cache fills up.
+	mVUcacheCollect(mVU);
+	if (resetReserve)
+	{
+		microDiskCache& dc = mVUdiskCache[mVU.index];
+		mVUcacheSaveFile(mVU, dc);
+		dc.pending = EmuConfig.Cpu.Recompiler.EnableVUProgramCache;
+		dc.replayPos = 0;
+		dc.replayCount = 0;
+	}
+
+	const microProgStats& stats = mVU.prog.stats;
+	if (stats.hashHits || stats.listHits || stats.misses)
+	{
+		DevCon.WriteLn(mVU.index ? Color_Orange : Color_Magenta,
+			"microVU%d: Prog cache stats: %u hash hits, %u list hits, %u misses, %u evicted",
+			mVU.index, stats.hashHits, stats.listHits, stats.misses, stats.evictions);
+	}
+
 	// Program Variables
 	mVU.prog.cleared  =  1;
 	mVU.prog.isSame   = -1;
 	mVU.prog.cur      = NULL;
 	mVU.prog.total    =  0;
 	mVU.prog.curFrame =  0;
+	mVU.prog.useClock =  0;
+	mVU.prog.memHash  =  0;
+	std::memset(mVU.prog.chunkHash, 0, sizeof(mVU.prog.chunkHash));
+	std::memset(mVU.prog.chunkDirty, 0xff, sizeof(mVU.prog.chunkDirty));
+	std::memset(&mVU.prog.stats, 0, sizeof(mVU.prog.stats));
+	if (!mVU.prog.index)
+		mVU.prog.index = new microProgramIndex();
+	mVU.prog.index->clear();
+	if (!mVU.prog.evicted)
+		mVU.prog.evicted = new microProgramList();
+	for (microProgram*& prog : *mVU.prog.evicted)
+		mVUdeleteProg(mVU, prog);
+	mVU.prog.evicted->clear();
 
 	// Setup Dynarec Cache Limits for Each Program
 	mVU.prog.x86start = xGetAlignedCallTarget();
@@ -85,6 +119,14 @@ void mVUreset(microVU& mVU, bool resetReserve)
 // Free Allocated Resources
 void mVUclose(microVU& mVU)
 {
+	microDiskCache& dc = mVUdiskCache[mVU.index];
+	mVUcacheCollect(mVU);
+	mVUcacheSaveFile(mVU, dc);
+	dc.path.clear();
+	dc.progs.clear();
+	dc.hashes.clear();
+	dc.pending = false;
+
 	// Delete Programs and Block Managers
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
@@ -96,11 +138,39 @@ void mVUclose(microVU& mVU)
 		}
 		safe_delete(mVU.prog.prog[i]);
 	}
+	safe_delete(mVU.prog.index);
+	if (mVU.prog.evicted)
+	{
+		for (microProgram*& prog : *mVU.prog.evicted)
+			mVUdeleteProg(mVU, prog);
+		safe_delete(mVU.prog.evicted);
+	}
+}
+
+// Flags the hash chunks covering [addr, addr+size) as needing a rehash
+static __fi void mVUdirtyChunks(microVU& mVU, u32 addr, u32 size)
+{
+	if (!size)
+		return;
+	const u32 chunks = mVU.microMemSize / mVUhashChunkSize;
+	const u32 first  = addr / mVUhashChunkSize;
+	const u32 last   = (addr + size - 1) / mVUhashChunkSize;
+	if ((last - first) >= chunks)
+	{
+		std::memset(mVU.prog.chunkDirty, 0xff, sizeof(mVU.prog.chunkDirty));
+		return;
+	}
+	for (u32 i = first; i <= last; i++)
+	{
+		const u32 c = i & (chunks - 1);
+		mVU.prog.chunkDirty[c / 64] |= 1ULL << (c % 64);
+	}
 }
 
 // Clears Block Data in specified range
 __fi void mVUclear(mV, u32 addr, u32 size)
 {
+	mVUdirtyChunks(mVU, addr, size);
 	if (!mVU.prog.cleared)
 	{
 		mVU.prog.cleared = 1; // Next execution searches/creates a new microprogram
@@ -212,6 +282,79 @@ void mVUprintUniqueRatio(microVU& mVU)
 	DevCon.WriteLn("%d / %d [%3.1f%%]", v.size(), total, 100. - (double)v.size() / (double)total * 100.);
 }
 
+// Rehashes the micro memory chunks written since the last call, and returns
+// a hash of the whole of mVU.regs().Micro. Only dirty chunks are read, so a
+// small MPG upload costs a small rehash rather than a full memory scan.
+static u64 mVUupdateMemHash(microVU& mVU)
+{
+	const u32 chunks = mVU.microMemSize / mVUhashChunkSize;
+	for (u32 w = 0; w < (chunks + 63) / 64; w++)
+	{
+		u64 dirty = mVU.prog.chunkDirty[w];
+		mVU.prog.chunkDirty[w] = 0;
+		while (dirty)
+		{
+			const u32 c = w * 64 + std::countr_zero(dirty);
+			dirty &= dirty - 1;
+			if (c >= chunks)
+				break;
+
+			const u64* src = reinterpret_cast<const u64*>(mVU.regs().Micro + c * mVUhashChunkSize);
+			u64 h = c;
+			for (u32 i = 0; i < mVUhashChunkSize / sizeof(u64); i++)
+			{
+				h = (h ^ src[i]) * 0x9E3779B97F4A7C15ULL;
+				h ^= h >> 29;
+			}
+			mVU.prog.memHash ^= mVU.prog.chunkHash[c] ^ h;
+			mVU.prog.chunkHash[c] = h;
+		}
+	}
+	return mVU.prog.memHash;
+}
+
+// Drops the least recently used program from a startPC list
+static void mVUevictProg(microVU& mVU, microProgramList& list)
+{
+	auto lru = list.end();
+	for (auto it = list.begin(); it != list.end(); ++it)
+	{
+		if (*it == mVU.prog.cur)
+			continue;
+		if (lru == list.end() || (s32)((*it)->lastUsed - (*lru)->lastUsed) < 0)
+			lru = it;
+	}
+	if (lru == list.end())
+		return;
+
+	microProgram* prog = *lru;
+	list.erase(lru);
+	for (auto it = mVU.prog.index->begin(); it != mVU.prog.index->end();)
+	{
+		if (it->second == prog)
+			it = mVU.prog.index->erase(it);
+		else
+			++it;
+	}
+
+	// Compiled code (and jumpCache entries in other programs) stays around until
+	// the next reset, so only the block managers can be released here. Freeing the
+	// program itself would let a new program reuse its address and match those
+	// stale jumpCache entries.
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+		safe_delete(prog->block[i]);
+	mVU.prog.evicted->push_back(prog);
+	mVU.prog.stats.evictions++;
+}
+
+// Remembers which program matched the current micro memory contents
+static __fi void mVUindexProg(microVU& mVU, u64 key, microProgram* prog)
+{
+	if (mVU.prog.index->size() >= mVUmaxIndexSize)
+		mVU.prog.index->clear();
+	(*mVU.prog.index)[key] = prog;
+}
+
 // Compare Cached microProgram to mVU.regs().Micro
 __fi bool mVUcmpProg(microVU& mVU, microProgram& prog)
 {
@@ -240,6 +383,47 @@ __fi bool mVUcmpProg(microVU& mVU, microProgram& prog)
 	return true;
 }
 
+// Key of the hash index for the current micro memory and start PC
+static __fi u64 mVUprogKey(microVU& mVU)
+{
+	return mVUupdateMemHash(mVU) ^ ((u64)(mVU.regs().start_pc / 8) * 0xC2B2AE3D27D4EB4FULL);
+}
+
+// Looks up an already recompiled program matching mVU.regs().Micro, and makes it
+// the quick-reference program for startPC. Returns nullptr when it must be compiled.
+static microProgram* mVUfindProg(microVU& mVU, microProgramQuick& quick, microProgramList& list, u64 key, u32 startPC)
+{
+	// The index only narrows the search down to one candidate, which still
+	// has to pass the usual range compare (hashes can collide, and writes that
+	// bypass mVUclear() leave stale chunk hashes behind).
+	auto found = mVU.prog.index->find(key);
+	if (found != mVU.prog.index->end() && mVUcmpProg(mVU, *found->second))
+	{
+		mVU.prog.stats.hashHits++;
+		quick.block = found->second->block[startPC / 8];
+		quick.prog  = found->second;
+		quick.prog->lastUsed = ++mVU.prog.useClock;
+		return quick.prog;
+	}
+
+	for (auto it = list.begin(); it != list.end(); ++it)
+	{
+		if (mVUcmpProg(mVU, *it[0]))
+		{
+			mVU.prog.stats.listHits++;
+			quick.block = it[0]->block[startPC / 8];
+			quick.prog  = it[0];
+			quick.prog->lastUsed = ++mVU.prog.useClock;
+			list.erase(it);
+			list.push_front(quick.prog);
+			mVUindexProg(mVU, key, quick.prog);
+			return quick.prog;
+		}
+	}
+
+	return nullptr;
+}
+
 // Searches for Cached Micro Program and sets prog.cur to it (returns entry-point to program)
 _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 {
@@ -249,25 +433,19 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
-		for (auto it = list->begin(); it != list->end(); ++it)
-		{
-			bool b = mVUcmpProg(mVU, *it[0]);
+		if (mVUdiskCache[mVU.index].pending)
+			mVUcacheReplay(mVU);
 
-			if (b)
+		const u64 key = mVUprogKey(mVU);
+		if (mVUfindProg(mVU, quick, *list, key, startPC))
+		{
+			// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
+			if (quick.block == nullptr)
 			{
-				quick.block = it[0]->block[startPC / 8];
-				quick.prog  = it[0];
-				list->erase(it);
-				list->push_front(quick.prog);
-
-				// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
-				if (quick.block == nullptr)
-				{
-					void* entryPoint = mVUblockFetch(mVU, startPC, pState);
-					return entryPoint;
-				}
-				return mVUentryGet(mVU, quick.block, startPC, pState);
+				void* entryPoint = mVUblockFetch(mVU, startPC, pState);
+				return entryPoint;
 			}
+			return mVUentryGet(mVU, quick.block, startPC, pState);
 		}
 
 		// If cleared and program not found, make a new program instance
@@ -277,7 +455,12 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 		void* entryPoint = mVUblockFetch(mVU,  startPC, pState);
 		quick.block      = mVU.prog.cur->block[startPC/8];
 		quick.prog       = mVU.prog.cur;
+		quick.prog->lastUsed = ++mVU.prog.useClock;
+		mVU.prog.stats.misses++;
 		list->push_front(mVU.prog.cur);
+		mVUindexProg(mVU, key, mVU.prog.cur);
+		if (list->size() > mVUmaxProgsPerPC)
+			mVUevictProg(mVU, *list);
 		//mVUprintUniqueRatio(mVU);
 		return entryPoint;
 	}
@@ -298,6 +481,154 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 	return mVUentryGet(mVU, quick.block, startPC, pState);
 }
 
+//------------------------------------------------------------------
+// Micro VU - Background Compilation (VU1 on the EE thread only)
+//------------------------------------------------------------------
+// When a VU1 program isn't in the cache, it's handed to a compiler thread and
+// run on the interpreter in the meantime. The switch between the two only
+// happens at program boundaries, where both agree on the state through the VI
+// flag registers. MTVU can't use this, as the interpreter kicks XGKICK packets
+// and touches VIF registers from whichever thread it runs on.
+
+struct microAsyncCompile
+{
+	enum : int
+	{
+		Idle,
+		Compiling,
+	};
+
+	Threading::Thread thread;
+	Threading::KernelSemaphore work;
+	std::atomic<int> state{Idle};
+	std::atomic<bool> shutdown{false};
+	u32 startPC;                          // Entry point of the program being compiled
+	u32 listIdx;                          // mVU.prog.prog[] list the program goes into
+	alignas(16) microRegInfo pState;      // Pipeline state at the entry point
+	bool interpreting;                    // A program started on the interpreter hasn't ended yet
+};
+
+static microAsyncCompile mVUasync;
+
+static void mVUasyncThread()
+{
+	Threading::SetNameOfCurrentThread("microVU1 Compiler");
+
+	microVU& mVU = microVU1;
+	for (;;)
+	{
+		mVUasync.work.Wait();
+		if (mVUasync.shutdown.load(std::memory_order_acquire))
+			break;
+
+		// The EE thread stays off microVU1 (and its micro memory) until state goes back to Idle.
+		xSetTextPtr(mVU.textPtr());
+		xSetPtr(mVU.prog.x86ptr);
+		mVU.prog.cleared = 0;
+		mVU.prog.isSame  = 1;
+		mVU.prog.cur     = mVUcreateProg(mVU, mVUasync.listIdx);
+		mVUblockFetch(mVU, mVUasync.startPC, (uptr)&mVUasync.pState);
+		mVU.prog.x86ptr  = x86Ptr;
+
+		microProgramList& list = *mVU.prog.prog[mVUasync.listIdx];
+		mVU.prog.cur->lastUsed = ++mVU.prog.useClock;
+		mVU.prog.stats.misses++;
+		list.push_front(mVU.prog.cur);
+		if (list.size() > mVUmaxProgsPerPC)
+			mVUevictProg(mVU, list);
+
+		// Picked up from the list by the next search on the EE thread.
+		mVU.prog.cur     = nullptr;
+		mVU.prog.cleared = 1;
+		mVU.prog.isSame  = -1;
+
+		mVUasync.state.store(microAsyncCompile::Idle, std::memory_order_release);
+		mVUasync.state.notify_all();
+	}
+}
+
+static void mVUasyncWait()
+{
+	mVUasync.state.wait(microAsyncCompile::Compiling, std::memory_order_acquire);
+}
+
+static void mVUasyncShutdown()
+{
+	if (!mVUasync.thread.Joinable())
+		return;
+
+	mVUasyncWait();
+	mVUasync.shutdown.store(true, std::memory_order_release);
+	mVUasync.work.Post();
+	mVUasync.thread.Join();
+	mVUasync.shutdown.store(false, std::memory_order_release);
+}
+
+// Copies the VI flag registers into the interpreter's working flags
+static void mVUasyncEnterInterpreter()
+{
+	VU1.macflag    = VU1.VI[REG_MAC_FLAG].UL;
+	VU1.statusflag = VU1.VI[REG_STATUS_FLAG].UL;
+	VU1.clipflag   = VU1.VI[REG_CLIP_FLAG].UL;
+}
+
+// Copies the VI flag registers into the flag instances microVU starts programs with
+static void mVUasyncLeaveInterpreter()
+{
+	const u32 status = VU1.VI[REG_STATUS_FLAG].UL;
+	const u32 denormStatus = ((status >> 3) & 0x18u) | ((status >> 11) & 0x1800u) | ((status >> 14) & 0x3cf0000u); // from mVUallocSFLAGd()
+	for (u32 i = 0; i < 4; i++)
+	{
+		VU1.micro_macflags[i]    = VU1.VI[REG_MAC_FLAG].UL;
+		VU1.micro_clipflags[i]   = VU1.VI[REG_CLIP_FLAG].UL;
+		VU1.micro_statusflags[i] = denormStatus;
+	}
+	std::memset(&microVU1.prog.lpState, 0, sizeof(microVU1.prog.lpState));
+}
+
+// Returns true if this VU1 execution should run on the interpreter
+static bool mVUasyncUseInterpreter()
+{
+	if (mVUasync.interpreting)
+		return true;
+
+	if (mVUasync.state.load(std::memory_order_acquire) == microAsyncCompile::Compiling)
+	{
+		// Only switch at the start of a program, mid-program state doesn't carry over.
+		if ((VU1.VI[REG_TPC].UL << 3) != VU1.start_pc)
+		{
+			mVUasyncWait();
+			return false;
+		}
+		mVUasync.interpreting = true;
+		return true;
+	}
+
+	microVU& mVU = microVU1;
+	const u32 startPC = VU1.start_pc & 0x3ff8;
+	microProgramQuick& quick = mVU.prog.quick[startPC / 8];
+	if (quick.prog || mVUdiskCache[1].pending || (VU1.VI[REG_TPC].UL << 3) != VU1.start_pc)
+		return false;
+
+	if (mVUfindProg(mVU, quick, *mVU.prog.prog[startPC / 8], mVUprogKey(mVU), startPC))
+		return false;
+
+	if (!mVUasync.thread.Joinable())
+	{
+		mVUasync.thread.SetStackSize(VMManager::EMU_THREAD_STACK_SIZE);
+		mVUasync.thread.Start(mVUasyncThread);
+	}
+
+	mVUasync.startPC = startPC;
+	mVUasync.listIdx = startPC / 8;
+	mVUasync.pState  = mVU.prog.lpState;
+	mVUasync.state.store(microAsyncCompile::Compiling, std::memory_order_release);
+	mVUasync.work.Post();
+
+	mVUasync.interpreting = true;
+	return true;
+}
+
 //------------------------------------------------------------------
 // recMicroVU0 / recMicroVU1
 //------------------------------------------------------------------
@@ -320,17 +651,21 @@ void recMicroVU1::Reserve()
 
 void recMicroVU0::Shutdown()
 {
+	vu0Thread.Close();
 	mVUclose(microVU0);
 }
 void recMicroVU1::Shutdown()
 {
 	if (vu1Thread.IsOpen())
 		vu1Thread.WaitVU();
+	mVUasyncShutdown();
+	mVUasync.interpreting = false;
 	mVUclose(microVU1);
 }
 
 void recMicroVU0::Reset()
 {
+	vu0Thread.WaitVU();
 	mVUreset(microVU0, true);
 }
 
@@ -342,6 +677,8 @@ void recMicroVU1::Reset()
 {
 	vu1Thread.WaitVU();
 	vu1Thread.Get_MTVUChanges();
+	mVUasyncWait();
+	mVUasync.interpreting = false;
 	mVUreset(microVU1, true);
 }
 
@@ -354,13 +691,14 @@ void recMicroVU0::Execute(u32 cycles)
 {
 	VU0.flags &= ~VUFLAG_MFLAGSET;
 
-	if (!(VU0.VI[REG_VPU_STAT].UL & 1))
+	// On the VU0 thread, the program's busy bit lives in vu0Thread.vpuStat
+	if (!((THREAD_VU0 ? vu0Thread.vpuStat : VU0.VI[REG_VPU_STAT].UL) & 1))
 		return;
 	VU0.VI[REG_TPC].UL <<= 3;
 
 	((mVUrecCall)microVU0.startFunct)(VU0.VI[REG_TPC].UL, cycles);
 	VU0.VI[REG_TPC].UL >>= 3;
-	if (microVU0.regs().flags & 0x4)
+	if (microVU0.regs().flags & 0x4 && !THREAD_VU0)
 	{
 		microVU0.regs().flags &= ~0x4;
 		hwIntcIrq(6);
@@ -382,6 +720,18 @@ void recMicroVU1::Execute(u32 cycles)
 	{
 		if (!(VU0.VI[REG_VPU_STAT].UL & 0x100))
 			return;
+
+		if (EmuConfig.Cpu.Recompiler.EnableVU1AsyncCompile && mVUasyncUseInterpreter())
+		{
+			mVUasyncEnterInterpreter();
+			CpuIntVU1.Execute(cycles);
+			if (!(VU0.VI[REG_VPU_STAT].UL & 0x100))
+			{
+				mVUasync.interpreting = false;
+				mVUasyncLeaveInterpreter();
+			}
+			return;
+		}
 	}
 	VU1.VI[REG_TPC].UL <<= 3;
 	((mVUrecCall)microVU1.startFunct)(VU1.VI[REG_TPC].UL, cycles);
@@ -395,16 +745,18 @@ void recMicroVU1::Execute(u32 cycles)
 
 void recMicroVU0::Clear(u32 addr, u32 size)
 {
+	vu0Thread.WaitVU();
 	mVUclear(microVU0, addr, size);
 }
 void recMicroVU1::Clear(u32 addr, u32 size)
 {
+	mVUasyncWait();
 	mVUclear(microVU1, addr, size);
 }
 
 void recMicroVU1::ResumeXGkick()
 {
-	if (!(VU0.VI[REG_VPU_STAT].UL & 0x100))
+	if (!(VU0.VI[REG_VPU_STAT].UL & 0x100) || mVUasync.interpreting)
 		return;
 	((mVUrecCallXG)microVU1.startFunctXG)();
 }
@@ -414,6 +766,20 @@ bool SaveStateBase::vuJITFreeze()
 	if (IsSaving())
 		vu1Thread.WaitVU();
 
+	// The interpreter's pipeline state has no microVU equivalent, so finish the program there.
+	mVUasyncWait();
+	if (mVUasync.interpreting && IsSaving())
+	{
+		CpuIntVU1.Execute(vu1RunCycles);
+		if (VU0.VI[REG_VPU_STAT].UL & 0x100)
+		{
+			DevCon.Warning("Force Stopping VU1, ran for too long");
+			VU0.VI[REG_VPU_STAT].UL &= ~0x100;
+		}
+		mVUasyncLeaveInterpreter();
+	}
+	mVUasync.interpreting = false;
+
 	Freeze(microVU0.prog.lpState);
 	Freeze(microVU1.prog.lpState);
 	return IsOkay();
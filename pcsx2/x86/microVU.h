@@ -9,11 +9,14 @@
 #include <deque>
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include "Common.h"
 #include "VU.h"
 #include "MTVU.h"
+#include "MTVU0.h"
 #include "GS.h"
 #include "Gif_Unit.h"
+#include "PerformanceMetrics.h"
 #include "iR5900.h"
 #include "R5900OpcodeTables.h"
 #include "common/emitter/x86emitter.h"
@@ -48,11 +51,26 @@ struct microProgram
 	u32                data [mProgSize];     // Holds a copy of the VU microProgram
 	microBlockManager* block[mProgSize / 2]; // Array of Block Managers
 	std::deque<microRange>* ranges;          // The ranges of the microProgram that have already been recompiled
-	u32 startPC; // Start PC of this program
-	int idx;     // Program index
+	u32 startPC;  // Start PC of this program
+	int idx;      // Program index
+	u32 lastUsed; // Value of microProgManager::useClock when this program was last selected (LRU eviction)
 };
 
 typedef std::deque<microProgram*> microProgramList;
+typedef std::unordered_map<u64, microProgram*> microProgramIndex;
+
+static const uint mVUhashChunkSize  = 64;                       // Bytes of micro memory covered by each incremental hash chunk
+static const uint mVUhashChunks     = 0x4000 / mVUhashChunkSize; // Chunk count for the largest micro memory (VU1)
+static const uint mVUmaxProgsPerPC  = 128;                      // Least recently used programs beyond this are evicted from a startPC list
+static const uint mVUmaxIndexSize   = 8192;                     // Hash index is flushed when it grows beyond this many entries
+
+struct microProgStats
+{
+	u32 hashHits;  // Programs found through the micro memory hash index
+	u32 listHits;  // Programs found by walking the startPC list
+	u32 misses;    // Programs that had to be recompiled
+	u32 evictions; // Programs dropped by the LRU policy
+};
 
 struct microProgramQuick
 {
@@ -65,6 +83,13 @@ struct microProgManager
 	microIR<mProgSize> IRinfo;             // IR information
 	microProgramList*  prog [mProgSize/2]; // List of microPrograms indexed by startPC values
 	microProgramQuick  quick[mProgSize/2]; // Quick reference to valid microPrograms for current execution
+	microProgramIndex* index;              // Micro memory hash (mixed with startPC) -> program last found for that memory
+	microProgramList*  evicted;            // Evicted programs, kept allocated until reset so stale jumpCache prog pointers can't alias new programs
+	u64                chunkHash[mVUhashChunks];     // Per-chunk hashes of mVU.regs().Micro
+	u64                chunkDirty[mVUhashChunks/64]; // Chunks written since their hash was last computed
+	u64                memHash;            // Combination of all chunkHash entries
+	u32                useClock;           // Incremented every time a program is selected
+	microProgStats     stats;              // Program cache statistics (reported on reset)
 	microProgram*      cur;                // Pointer to currently running MicroProgram
 	int                total;              // Total Number of valid MicroPrograms
 	int                isSame;             // Current cached microProgram is Exact Same program as mVU.regs().Micro (-1 = unknown, 0 = No, 1 = Yes)
@@ -248,6 +273,14 @@ public:
 		}
 		return nullptr;
 	}
+	template <typename F>
+	void forEach(F&& func) const
+	{
+		for (microBlockLink* linkI = qBlockList; linkI != nullptr; linkI = linkI->next)
+			func(linkI->block);
+		for (microBlockLink* linkI = fBlockList; linkI != nullptr; linkI = linkI->next)
+			func(linkI->block);
+	}
 	void printInfo(int pc, bool printQuick)
 	{
 		int listI = printQuick ? qListI : fListI;
@@ -294,6 +327,7 @@ mVUop(mVUopL);
 
 // Private Functions
 extern void mVUcacheProg(microVU& mVU, microProgram& prog);
+extern microProgram* mVUcreateProg(microVU& mVU, int startPC);
 extern void mVUdeleteProg(microVU& mVU, microProgram*& prog);
 _mVUt extern void* mVUsearchProg(u32 startPC, uptr pState);
 extern void* mVUexecuteVU0(u32 startPC, u32 cycles);
@@ -329,3 +363,4 @@ void sortVector(T& v)
 #include "microVU_Compile.inl"
 #include "microVU_Execute.inl"
 #include "microVU_Macro.inl"
+#include "microVU_Cache.inl"
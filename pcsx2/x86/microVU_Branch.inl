@@ -123,7 +123,7 @@ void mVUDTendProgram(mV, microFlagCycles* mFC, int isEbit)
 	{
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xAND(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? ~0x100 : ~0x001)); // VBS0/VBS1 flag
+			xAND(ptr32[mVUvpuStat(mVU)], (isVU1 ? ~0x100 : ~0x001)); // VBS0/VBS1 flag
 		}
 	}
 
@@ -244,7 +244,7 @@ void mVUendProgram(mV, microFlagCycles* mFC, int isEbit)
 			xMOV(ptr32[&mVU.regs().nextBlockCycles], 0);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xAND(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? ~0x100 : ~0x001)); // VBS0/VBS1 flag
+			xAND(ptr32[mVUvpuStat(mVU)], (isVU1 ? ~0x100 : ~0x001)); // VBS0/VBS1 flag
 		}
 	}
 	else if (isEbit)
@@ -345,7 +345,7 @@ void normBranch(mV, microFlagCycles& mFC)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x200 : 0x2));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x200 : 0x2));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		iPC = branchAddr(mVU) / 4;
@@ -366,7 +366,7 @@ void normBranch(mV, microFlagCycles& mFC)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x400 : 0x4));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x400 : 0x4));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		iPC = branchAddr(mVU) / 4;
@@ -422,7 +422,7 @@ void condBranch(mV, microFlagCycles& mFC, int JMPcc)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x400 : 0x4));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x400 : 0x4));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		mVUDTendProgram(mVU, &mFC, 2);
@@ -453,7 +453,7 @@ void condBranch(mV, microFlagCycles& mFC, int JMPcc)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x200 : 0x2));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x200 : 0x2));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		mVUDTendProgram(mVU, &mFC, 2);
@@ -586,7 +586,7 @@ void normJump(mV, microFlagCycles& mFC)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x200 : 0x2));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x200 : 0x2));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		mVUDTendProgram(mVU, &mFC, 2);
@@ -607,7 +607,7 @@ void normJump(mV, microFlagCycles& mFC)
 		xForwardJump32 eJMP(Jcc_Zero);
 		if (!mVU.index || !THREAD_VU1)
 		{
-			xOR(ptr32[&VU0.VI[REG_VPU_STAT].UL], (isVU1 ? 0x400 : 0x4));
+			xOR(ptr32[mVUvpuStat(mVU)], (isVU1 ? 0x400 : 0x4));
 			xOR(ptr32[&mVU.regs().flags], VUFLAG_INTCINTERRUPT);
 		}
 		mVUDTendProgram(mVU, &mFC, 2);
@@ -0,0 +1,368 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "BuildVersion.h"
+#include "Config.h"
+#include "VMManager.h"
+
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include "fmt/format.h"
+
+#include <unordered_set>
+
+//------------------------------------------------------------------
+// Micro VU - Program Cache
+//------------------------------------------------------------------
+// Recompiled code refers to mVU state, block structures and other blocks
+// by absolute address, so it can't be written out and loaded back as-is.
+// Instead, we store what is needed to reproduce a translation: the program
+// image, its compiled ranges, and the entry pipeline state of every block.
+// After a reset, programs stored for the running game are recompiled a
+// few at a time on each program search miss, so scene changes later on
+// find them already sitting in the program lists without a hitch at boot.
+
+static constexpr u32 MVU_CACHE_SIGNATURE = 0x4355564D; // 'MVUC'
+static constexpr u32 MVU_CACHE_VERSION = 1;
+static constexpr u32 mVUcacheMaxProgs = 2048; // Programs stored per game/VU
+static constexpr u32 mVUcacheMaxBlocks = 4096; // Blocks stored per program
+static constexpr u32 mVUcacheReplayBatch = 16; // Programs recompiled per program search miss
+
+struct microCacheBlock
+{
+	microRegInfo pState; // Pipeline state the block was compiled for
+	u32 pc;              // Start PC of the block
+};
+
+struct microCacheProg
+{
+	u32 startPC;                        // Index into mVU.prog.prog (start_pc / 8)
+	std::vector<microRange> ranges;     // Compiled ranges (what is compared on lookup)
+	std::vector<u32> data;              // Micro memory image the program was compiled from
+	std::vector<microCacheBlock> blocks; // Block entry points to recompile
+};
+
+struct microDiskCache
+{
+	std::string path;                  // Cache file for the running game (empty = disabled)
+	std::vector<microCacheProg> progs; // Stored programs
+	std::unordered_set<u64> hashes;    // Hashes of stored programs, to skip duplicates
+	u32 replayPos;                     // Next stored program to replay
+	u32 replayCount;                   // Programs replayed since the reset
+	bool dirty;                        // Programs were added since the file was read
+	bool pending;                      // Replay continues on the next program search
+};
+
+static microDiskCache mVUdiskCache[2];
+
+// Hashes the settings which affect code recompiled for this VU, plus the build itself.
+// Anything else (EE/IOP options, the cache toggle itself) must not discard the cache.
+static u64 mVUcacheSettingsKey(microVU& mVU)
+{
+	u64 h = 0xcbf29ce484222325ULL;
+	auto mix = [&h](u64 v) {
+		h = (h ^ v) * 0x100000001b3ULL;
+	};
+	mix(CHECK_VU_OVERFLOW(mVU.index));
+	mix(CHECK_VU_EXTRA_OVERFLOW(mVU.index));
+	mix(CHECK_VU_SIGN_OVERFLOW(mVU.index));
+	mix(CHECK_VU_UNDERFLOW(mVU.index));
+	mix(mVU.index ? EmuConfig.Cpu.VU1FPCR.bitmask : EmuConfig.Cpu.VU0FPCR.bitmask);
+	mix(mVU.index ? THREAD_VU1 : THREAD_VU0);
+	mix(CHECK_FASTMEM);
+	mix(EmuConfig.Speedhacks.vuFlagHack);
+	mix(EmuConfig.Speedhacks.vu1Instant);
+	mix(EmuConfig.Speedhacks.EECycleRate);
+	mix(EmuConfig.Speedhacks.EECycleSkip);
+	mix(CHECK_VUADDSUBHACK);
+	mix(CHECK_VUOVERFLOWHACK);
+	mix(CHECK_XGKICKHACK);
+	mix(EmuConfig.Gamefixes.IbitHack);
+	mix(EmuConfig.Gamefixes.VUSyncHack);
+	mix(EmuConfig.Gamefixes.FullVU0SyncHack);
+	mix(mVU.index);
+	mix(mVU.microMemSize);
+	mix(sizeof(microRegInfo));
+	for (const char* c = BuildVersion::GitRev; *c; c++)
+		mix(static_cast<u8>(*c));
+	return h;
+}
+
+static u64 mVUcacheProgHash(const microCacheProg& cp)
+{
+	u64 h = 0xcbf29ce484222325ULL ^ cp.startPC;
+	for (const microRange& range : cp.ranges)
+	{
+		h = (h ^ ((u64)range.start << 32 | (u32)range.end)) * 0x100000001b3ULL;
+		for (s32 i = range.start / 4; i < range.end / 4; i++)
+			h = (h ^ cp.data[i]) * 0x100000001b3ULL;
+	}
+	return h;
+}
+
+static std::string mVUcacheFilename(microVU& mVU)
+{
+	if (!EmuConfig.Cpu.Recompiler.EnableVUProgramCache)
+		return {};
+
+	const std::string serial = VMManager::GetDiscSerial();
+	if (serial.empty())
+		return {};
+
+	return Path::Combine(EmuFolders::Cache,
+		Path::Combine("vu", fmt::format("{}_{:08X}_vu{}.bin", serial, VMManager::GetDiscCRC(), mVU.index)));
+}
+
+template <typename T>
+static bool mVUcacheRead(std::FILE* fp, T* dst, size_t count = 1)
+{
+	return (std::fread(dst, sizeof(T), count, fp) == count);
+}
+
+static bool mVUcacheLoadFile(microVU& mVU, microDiskCache& dc)
+{
+	auto fp = FileSystem::OpenManagedCFile(dc.path.c_str(), "rb");
+	if (!fp)
+		return true;
+
+	u32 signature, version, count;
+	u64 key;
+	if (!mVUcacheRead(fp.get(), &signature) || signature != MVU_CACHE_SIGNATURE ||
+		!mVUcacheRead(fp.get(), &version) || version != MVU_CACHE_VERSION ||
+		!mVUcacheRead(fp.get(), &key) || !mVUcacheRead(fp.get(), &count) || count > mVUcacheMaxProgs)
+	{
+		return false;
+	}
+
+	// Different settings or build, the stored programs would compile differently.
+	if (key != mVUcacheSettingsKey(mVU))
+	{
+		DevCon.WriteLn("microVU%d: Program cache settings changed, discarding.", mVU.index);
+		return true;
+	}
+
+	const s32 memSize = static_cast<s32>(mVU.microMemSize);
+	dc.progs.reserve(count);
+	for (u32 i = 0; i < count; i++)
+	{
+		microCacheProg cp;
+		u32 numRanges, numBlocks;
+		if (!mVUcacheRead(fp.get(), &cp.startPC) || cp.startPC >= (mVU.progSize / 2) ||
+			!mVUcacheRead(fp.get(), &numRanges) || numRanges == 0 || numRanges > (mVU.progSize / 2))
+		{
+			return false;
+		}
+
+		cp.ranges.resize(numRanges);
+		if (!mVUcacheRead(fp.get(), cp.ranges.data(), numRanges))
+			return false;
+		for (const microRange& range : cp.ranges)
+		{
+			if (range.start < 0 || range.end > memSize || range.start > range.end)
+				return false;
+		}
+
+		cp.data.resize(mVU.progSize);
+		if (!mVUcacheRead(fp.get(), cp.data.data(), mVU.progSize) ||
+			!mVUcacheRead(fp.get(), &numBlocks) || numBlocks == 0 || numBlocks > mVUcacheMaxBlocks)
+		{
+			return false;
+		}
+
+		cp.blocks.resize(numBlocks);
+		if (!mVUcacheRead(fp.get(), cp.blocks.data(), numBlocks))
+			return false;
+		for (const microCacheBlock& cb : cp.blocks)
+		{
+			if ((cb.pc & 7) || cb.pc > mVU.microMemSize - 8)
+				return false;
+		}
+
+		if (dc.hashes.insert(mVUcacheProgHash(cp)).second)
+			dc.progs.push_back(std::move(cp));
+	}
+
+	return true;
+}
+
+static void mVUcacheSaveFile(microVU& mVU, microDiskCache& dc)
+{
+	if (!dc.dirty || dc.path.empty())
+		return;
+	dc.dirty = false;
+
+	if (!FileSystem::EnsureDirectoryExists(std::string(Path::GetDirectory(dc.path)).c_str(), true))
+		return;
+
+	auto fp = FileSystem::OpenManagedCFile(dc.path.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("microVU%d: Failed to open '%s' for writing.", mVU.index, dc.path.c_str());
+		return;
+	}
+
+	const u32 count = static_cast<u32>(dc.progs.size());
+	const u64 key = mVUcacheSettingsKey(mVU);
+	bool okay = (std::fwrite(&MVU_CACHE_SIGNATURE, sizeof(u32), 1, fp.get()) == 1 &&
+				 std::fwrite(&MVU_CACHE_VERSION, sizeof(u32), 1, fp.get()) == 1 &&
+				 std::fwrite(&key, sizeof(key), 1, fp.get()) == 1 &&
+				 std::fwrite(&count, sizeof(count), 1, fp.get()) == 1);
+	for (const microCacheProg& cp : dc.progs)
+	{
+		if (!okay)
+			break;
+		const u32 numRanges = static_cast<u32>(cp.ranges.size());
+		const u32 numBlocks = static_cast<u32>(cp.blocks.size());
+		okay = (std::fwrite(&cp.startPC, sizeof(u32), 1, fp.get()) == 1 &&
+				std::fwrite(&numRanges, sizeof(u32), 1, fp.get()) == 1 &&
+				std::fwrite(cp.ranges.data(), sizeof(microRange), numRanges, fp.get()) == numRanges &&
+				std::fwrite(cp.data.data(), sizeof(u32), cp.data.size(), fp.get()) == cp.data.size() &&
+				std::fwrite(&numBlocks, sizeof(u32), 1, fp.get()) == 1 &&
+				std::fwrite(cp.blocks.data(), sizeof(microCacheBlock), numBlocks, fp.get()) == numBlocks);
+	}
+
+	if (!okay)
+	{
+		Console.Error("microVU%d: Failed to write program cache '%s'.", mVU.index, dc.path.c_str());
+		fp.reset();
+		FileSystem::DeleteFilePath(dc.path.c_str());
+		return;
+	}
+
+	DevCon.WriteLn("microVU%d: Wrote %u programs to cache.", mVU.index, count);
+}
+
+// Points the cache at the file for the running game, flushing the previous one
+static void mVUcacheSync(microVU& mVU)
+{
+	microDiskCache& dc = mVUdiskCache[mVU.index];
+	std::string path = mVUcacheFilename(mVU);
+	if (path == dc.path)
+		return;
+
+	mVUcacheSaveFile(mVU, dc);
+	dc.progs.clear();
+	dc.hashes.clear();
+	dc.replayPos = 0;
+	dc.dirty = false;
+	dc.path = std::move(path);
+	if (dc.path.empty())
+		return;
+
+	if (!mVUcacheLoadFile(mVU, dc))
+	{
+		Console.Warning("microVU%d: Deleting corrupted program cache '%s'.", mVU.index, dc.path.c_str());
+		dc.progs.clear();
+		dc.hashes.clear();
+		FileSystem::DeleteFilePath(dc.path.c_str());
+	}
+	else if (!dc.progs.empty())
+	{
+		DevCon.WriteLn("microVU%d: Read %zu programs from cache.", mVU.index, dc.progs.size());
+	}
+}
+
+// Adds programs recompiled this session to the cache (call before they are deleted)
+static void mVUcacheCollect(microVU& mVU)
+{
+	microDiskCache& dc = mVUdiskCache[mVU.index];
+	if (dc.path.empty())
+		return;
+
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		if (!mVU.prog.prog[i])
+			continue;
+		for (microProgram* prog : *mVU.prog.prog[i])
+		{
+			if (dc.progs.size() >= mVUcacheMaxProgs)
+				return;
+			if (prog->ranges->empty())
+				continue;
+
+			microCacheProg cp;
+			cp.startPC = prog->startPC;
+			cp.ranges.assign(prog->ranges->begin(), prog->ranges->end());
+			cp.data.assign(prog->data, prog->data + mVU.progSize);
+			for (u32 pc = 0; pc < (mVU.progSize / 2); pc++)
+			{
+				if (!prog->block[pc])
+					continue;
+				prog->block[pc]->forEach([&cp, pc](const microBlock& block) {
+					cp.blocks.push_back({block.pState, pc * 8});
+				});
+			}
+			if (cp.blocks.empty() || cp.blocks.size() > mVUcacheMaxBlocks)
+				continue;
+
+			if (dc.hashes.insert(mVUcacheProgHash(cp)).second)
+			{
+				dc.progs.push_back(std::move(cp));
+				dc.dirty = true;
+			}
+		}
+	}
+}
+
+// Recompiles the next batch of stored programs for the running game. Stops at
+// half of the rec-cache so that the game still has room before the next cache
+// reset, and never fills a startPC list past mVUmaxProgsPerPC.
+static void mVUcacheReplay(microVU& mVU)
+{
+	microDiskCache& dc = mVUdiskCache[mVU.index];
+	mVUcacheSync(mVU);
+	if (dc.replayPos >= dc.progs.size())
+	{
+		dc.pending = false;
+		return;
+	}
+
+	const u32 start_pc = mVU.regs().start_pc;
+	std::unique_ptr<u8[]> backup = std::make_unique<u8[]>(mVU.microMemSize);
+	std::memcpy(backup.get(), mVU.regs().Micro, mVU.microMemSize);
+
+	const u8* limit = mVU.prog.x86start + (mVU.prog.x86end - mVU.prog.x86start) / 2;
+	const u32 end = std::min<u32>(dc.replayPos + mVUcacheReplayBatch, static_cast<u32>(dc.progs.size()));
+	for (; dc.replayPos < end; dc.replayPos++)
+	{
+		if (xGetPtr() >= limit)
+		{
+			dc.replayPos = static_cast<u32>(dc.progs.size());
+			break;
+		}
+
+		const microCacheProg& cp = dc.progs[dc.replayPos];
+		if (mVU.prog.prog[cp.startPC]->size() >= mVUmaxProgsPerPC)
+			continue;
+
+		std::memcpy(mVU.regs().Micro, cp.data.data(), mVU.microMemSize);
+		mVU.regs().start_pc = cp.startPC * 8;
+		mVU.prog.cleared = 0;
+		mVU.prog.isSame  = 1;
+		mVU.prog.cur     = mVUcreateProg(mVU, cp.startPC);
+		for (const microCacheBlock& cb : cp.blocks)
+		{
+			alignas(16) microRegInfo pState = cb.pState;
+			mVUblockFetch(mVU, cb.pc, (uptr)&pState);
+		}
+		mVU.prog.cur->lastUsed = ++mVU.prog.useClock;
+		mVU.prog.prog[cp.startPC]->push_back(mVU.prog.cur);
+		dc.replayCount++;
+	}
+
+	std::memcpy(mVU.regs().Micro, backup.get(), mVU.microMemSize);
+	mVU.regs().start_pc = start_pc;
+	mVU.prog.cur     = nullptr;
+	mVU.prog.cleared = 1;
+	mVU.prog.isSame  = -1;
+
+	if (dc.replayPos >= dc.progs.size())
+	{
+		dc.pending = false;
+		Console.WriteLn(mVU.index ? Color_Orange : Color_Magenta, "microVU%d: Recompiled %u cached programs.",
+			mVU.index, dc.replayCount);
+	}
+}
@@ -357,6 +357,8 @@ _mVUt void mVUcleanUp()
 		u32 cycles_passed = std::min(mVU.cycles, 3000) * EmuConfig.Speedhacks.EECycleSkip;
 		if (cycles_passed > 0)
 		{
+			// THREAD_VU0 is off with EECycleSkip, so cpuRegs is only ever touched from the EE thread here.
+			pxAssert(!VU0_Thread::IsVU0Thread());
 			s64 vu0_offset = VU0.cycle - cpuRegs.cycle;
 			cpuRegs.cycle += cycles_passed;
 
@@ -319,6 +319,25 @@ void recBC2TL() { _setupBranchTest(JZ32,  true);  }
 // Macro VU - COP2 Transfer Instructions
 //------------------------------------------------------------------
 
+static void mVUWaitVU0Thread()
+{
+	vu0Thread.WaitVU();
+}
+
+// The VU0 thread owns VU0.cycle and VU0's registers until it has been waited on, and a program
+// which ran ahead of the EE would otherwise be skipped by the cycle checks below.
+// Expects the caller to have flushed for a call already.
+static void mVUWaitVU0ThreadPending()
+{
+	if (!THREAD_VU0)
+		return;
+
+	xCMP(ptr8[vu0Thread.GetPendingPtr()], 0);
+	xForwardJZ8 skip;
+	xFastCall((void*)mVUWaitVU0Thread);
+	skip.SetTarget();
+}
+
 static void COP2_Interlock(bool mBitSync)
 {
 	if (cpuRegs.code & 1)
@@ -331,6 +350,7 @@ static void COP2_Interlock(bool mBitSync)
 		{
 			iFlushCall(FLUSH_FOR_POSSIBLE_MICRO_EXEC);
 			_freeX86reg(eax);
+			mVUWaitVU0ThreadPending();
 			xMOV(rax, ptr64[&cpuRegs.cycle]);
 			xADD(rax, scaleblockcycles_clear());
 			xMOV(ptr64[&cpuRegs.cycle], rax); // update cycles
@@ -366,6 +386,7 @@ static void mVUSyncVU0()
 {
 	iFlushCall(FLUSH_FOR_POSSIBLE_MICRO_EXEC);
 	_freeX86reg(eax);
+	mVUWaitVU0ThreadPending();
 	xMOV(rax, ptr64[&cpuRegs.cycle]);
 	xADD(rax, scaleblockcycles_clear());
 	xMOV(ptr64[&cpuRegs.cycle], rax); // update cycles
@@ -291,7 +291,16 @@ static void mVUwaitMTVU()
 {
 	if (IsDevBuild)
 		DevCon.WriteLn("microVU0: Waiting on VU1 thread to access VU1 regs!");
-	vu1Thread.WaitVU();
+	if (VU0_Thread::IsVU0Thread())
+		vu0Thread.WaitForVU1();
+	else
+		vu1Thread.WaitVU();
+}
+
+// Returns the VPU_STAT word a VU's program updates its busy/D/T bits in
+static __fi u32* mVUvpuStat(mV)
+{
+	return (!isVU1 && THREAD_VU0) ? &vu0Thread.vpuStat : &VU0.VI[REG_VPU_STAT].UL;
 }
 
 // Transforms the Address in gprReg to valid VU0/VU1 Address
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/IPU/IPU_MultiISA.h"
+#include "pcsx2/IPU/yuv2rgb.h"
+#include "pcsx2/GS/MultiISA.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string.h>
+
+#include "cpuinfo.h"
+
+#ifdef MULTI_ISA_UNSHARED_COMPILATION
+
+enum class TestISA
+{
+	isa_sse4,
+	isa_avx,
+	isa_avx2,
+	isa_native,
+};
+
+static bool CheckCapabilities(TestISA required_caps)
+{
+	cpuinfo_initialize();
+	if (required_caps == TestISA::isa_avx && !cpuinfo_has_x86_avx())
+		return false;
+	if (required_caps == TestISA::isa_avx2 && !cpuinfo_has_x86_avx2())
+		return false;
+
+	return true;
+}
+
+#define MULTI_ISA_STRINGIZE_(x) #x
+#define MULTI_ISA_STRINGIZE(x) MULTI_ISA_STRINGIZE_(x)
+
+#define MULTI_ISA_CONCAT_(a, b) a##b
+#define MULTI_ISA_CONCAT(a, b) MULTI_ISA_CONCAT_(a, b)
+
+#define MULTI_ISA_TEST(group, name) TEST(MULTI_ISA_CONCAT(MULTI_ISA_CONCAT(MULTI_ISA_UNSHARED_COMPILATION, _), group), name)
+#define SKIP_IF_UNSUPPORTED() \
+	if (!CheckCapabilities(TestISA::MULTI_ISA_UNSHARED_COMPILATION)) { \
+		GTEST_SKIP() << "Host CPU does not support " MULTI_ISA_STRINGIZE(MULTI_ISA_UNSHARED_COMPILATION); \
+	}
+
+#else
+
+#define MULTI_ISA_TEST(group, name) TEST(group, name)
+#define SKIP_IF_UNSUPPORTED()
+
+#endif
+
+MULTI_ISA_UNSHARED_START
+
+enum class CoeffPattern
+{
+	Dense,    // Legal dequantised range
+	Sparse,   // Mostly zero, like real streams
+	DCOnly,   // Hits the row shortcut in the reference
+	Corrupt,  // Full s16 range, for broken streams
+};
+
+static void fillBlock(std::mt19937& rng, s16* block, CoeffPattern pattern)
+{
+	for (int i = 0; i < 64; i++)
+	{
+		const int legal = static_cast<int>(rng() % 4096) - 2048;
+		switch (pattern)
+		{
+			case CoeffPattern::Dense:   block[i] = legal; break;
+			case CoeffPattern::Sparse:  block[i] = (rng() % 8) ? 0 : legal; break;
+			case CoeffPattern::DCOnly:  block[i] = (i % 8) ? 0 : legal; break;
+			case CoeffPattern::Corrupt: block[i] = static_cast<s16>(rng()); break;
+		}
+	}
+}
+
+MULTI_ISA_TEST(IPUKernelTest, IDCT)
+{
+	SKIP_IF_UNSUPPORTED();
+
+	std::mt19937 rng(1234);
+	for (int iter = 0; iter < 20000; iter++)
+	{
+		const CoeffPattern pattern = static_cast<CoeffPattern>(iter % 4);
+		alignas(16) s16 expected[64];
+		alignas(16) s16 actual[64];
+		fillBlock(rng, expected, pattern);
+		memcpy(actual, expected, sizeof(actual));
+
+		ipu_idct_reference(expected);
+		ipu_idct(actual);
+		ASSERT_EQ(0, memcmp(expected, actual, sizeof(actual))) << "pattern " << static_cast<int>(pattern) << " iteration " << iter;
+	}
+}
+
+MULTI_ISA_TEST(IPUKernelTest, CSC)
+{
+	SKIP_IF_UNSUPPORTED();
+
+	std::mt19937 rng(5678);
+	for (int iter = 0; iter < 2000; iter++)
+	{
+		u8* mb8 = reinterpret_cast<u8*>(&decoder.mb8);
+		for (size_t i = 0; i < sizeof(decoder.mb8); i++)
+			mb8[i] = static_cast<u8>(rng());
+
+		yuv2rgb_reference();
+		const macroblock_rgb32 expected = decoder.rgb32;
+
+		memset(&decoder.rgb32, 0, sizeof(decoder.rgb32));
+		yuv2rgb();
+		ASSERT_EQ(0, memcmp(&expected, &decoder.rgb32, sizeof(expected))) << "iteration " << iter;
+	}
+}
+
+MULTI_ISA_UNSHARED_END
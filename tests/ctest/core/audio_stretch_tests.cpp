@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Host/AudioStretcher.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+	static constexpr u32 SAMPLE_RATE = 48000;
+	static constexpr u32 CHANNELS = 2;
+	static constexpr u32 BLOCK_FRAMES = 64;
+
+	// Roughly what the SPU2 puts out: a few detuned voices with envelopes, some reverb-ish noise, and silence.
+	std::vector<float> MakeSignal(u32 num_frames, float base_freq)
+	{
+		std::vector<float> out(num_frames * CHANNELS);
+		std::mt19937 rng(1234);
+		std::uniform_real_distribution<float> noise(-0.02f, 0.02f);
+		for (u32 i = 0; i < num_frames; i++)
+		{
+			const float t = static_cast<float>(i) / SAMPLE_RATE;
+			const float env = 0.5f + 0.5f * std::sin(2.0f * 3.14159265f * 0.5f * t);
+			const float voice = std::sin(2.0f * 3.14159265f * base_freq * t) * 0.5f +
+								std::sin(2.0f * 3.14159265f * base_freq * 2.003f * t) * 0.15f * env;
+			out[i * 2 + 0] = voice + noise(rng);
+			out[i * 2 + 1] = voice * 0.8f + noise(rng);
+		}
+		return out;
+	}
+
+	std::vector<float> Stretch(AudioStretcher& stretcher, const std::vector<float>& input, float tempo)
+	{
+		std::vector<float> output;
+		float block[BLOCK_FRAMES * CHANNELS];
+		stretcher.SetTempo(tempo);
+		for (size_t pos = 0; pos + BLOCK_FRAMES * CHANNELS <= input.size(); pos += BLOCK_FRAMES * CHANNELS)
+		{
+			stretcher.PutSamples(&input[pos], BLOCK_FRAMES);
+			u32 frames;
+			while ((frames = stretcher.ReceiveSamples(block, BLOCK_FRAMES)) != 0)
+				output.insert(output.end(), block, block + frames * CHANNELS);
+		}
+		return output;
+	}
+
+	// Counts rising zero crossings of the left channel, skipping the start while the stretcher fills up.
+	float MeasureFrequency(const std::vector<float>& samples)
+	{
+		const size_t frames = samples.size() / CHANNELS;
+		const size_t start = frames / 4;
+		u32 crossings = 0;
+		for (size_t i = start + 1; i < frames; i++)
+		{
+			if (samples[(i - 1) * CHANNELS] < 0.0f && samples[i * CHANNELS] >= 0.0f)
+				crossings++;
+		}
+		return static_cast<float>(crossings) * SAMPLE_RATE / static_cast<float>(frames - start);
+	}
+
+	std::unique_ptr<AudioStretcher> CreateStretcher(AudioStretchMode mode)
+	{
+		return AudioStretcher::Create(mode, SAMPLE_RATE, CHANNELS, AudioStreamParameters());
+	}
+} // namespace
+
+TEST(AudioStretch, KeepsPitchAndTempo)
+{
+	const std::vector<float> input = MakeSignal(SAMPLE_RATE * 4, 440.0f);
+	const float input_freq = MeasureFrequency(input);
+
+	for (u32 mode = 0; mode < static_cast<u32>(AudioStretchMode::Count); mode++)
+	{
+		// Allow for the audio each engine keeps buffered at the end, WSOLA holds on to less of it.
+		const float length_tolerance = (static_cast<AudioStretchMode>(mode) == AudioStretchMode::WSOLA) ? 0.03f : 0.05f;
+		for (const float tempo : {0.75f, 0.9f, 1.0f, 1.1f, 1.3f})
+		{
+			std::unique_ptr<AudioStretcher> stretcher = CreateStretcher(static_cast<AudioStretchMode>(mode));
+			const std::vector<float> output = Stretch(*stretcher, input, tempo);
+
+			SCOPED_TRACE(testing::Message() << "mode=" << mode << " tempo=" << tempo);
+			const float expected_frames = static_cast<float>(input.size() / CHANNELS) / tempo;
+			EXPECT_NEAR(static_cast<float>(output.size() / CHANNELS), expected_frames, expected_frames * length_tolerance);
+			EXPECT_NEAR(MeasureFrequency(output), input_freq, input_freq * 0.02f);
+		}
+	}
+}
+
+TEST(AudioStretch, ClearDropsBufferedAudio)
+{
+	std::unique_ptr<AudioStretcher> stretcher = CreateStretcher(AudioStretchMode::WSOLA);
+	const std::vector<float> input = MakeSignal(SAMPLE_RATE / 2, 440.0f);
+	stretcher->SetTempo(1.0f);
+	stretcher->PutSamples(input.data(), static_cast<u32>(input.size() / CHANNELS));
+	stretcher->Clear();
+
+	float block[BLOCK_FRAMES * CHANNELS];
+	EXPECT_EQ(stretcher->ReceiveSamples(block, BLOCK_FRAMES), 0u);
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "x86/BaseblockEx.h"
+
+#include "common/Timer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Roughly what a game streaming overlays looks like: lots of short blocks, a few long ones,
+// and a clear for every DMA into code memory.
+TEST(BaseBlocksBenchmark, ClearHeavy)
+{
+	static constexpr u32 NUM_BLOCKS = 0x10000;
+	static constexpr u32 NUM_CLEARS = 0x100000;
+	static constexpr u32 CODE_BYTES = 32 * 1024 * 1024;
+
+	std::mt19937 rng(1);
+
+	// Links keep pointers to their jump slots and patch them later, so the slots have to outlive the blocks.
+	std::vector<s32> jumps(NUM_BLOCKS * 2);
+	BaseBlocks blocks;
+
+	Common::Timer timer;
+	for (u32 i = 0; i < NUM_BLOCKS; i++)
+	{
+		const u32 startpc = (i * (CODE_BYTES / NUM_BLOCKS)) & ~3u;
+		const u32 size = ((i % 1024) == 0) ? 0x4000 : (4 + rng() % 32);
+		blocks.SetSize(blocks.New(startpc, 0), size);
+
+		// A couple of links per block, to random targets.
+		blocks.Link(rng() % CODE_BYTES & ~3u, &jumps[i * 2]);
+		blocks.Link(rng() % CODE_BYTES & ~3u, &jumps[i * 2 + 1]);
+	}
+	const double compile_seconds = timer.GetTimeSeconds();
+
+	u64 visited = 0;
+	timer.Reset();
+	for (u32 i = 0; i < NUM_CLEARS; i++)
+	{
+		const u32 addr = (rng() % CODE_BYTES) & ~3u;
+		const u32 end = addr + 0x100;
+		for (int idx = blocks.FirstIndexOverlapping(addr); const BASEBLOCKEX* block = blocks[idx]; idx++)
+		{
+			if (block->startpc >= end)
+				break;
+			visited++;
+		}
+	}
+	const double clear_seconds = timer.GetTimeSeconds();
+
+	std::printf("%u blocks: %.1f ns/block to compile and link, %.1f ns/clear, %.1f blocks visited per clear\n",
+		NUM_BLOCKS, compile_seconds * 1e9 / NUM_BLOCKS, clear_seconds * 1e9 / NUM_CLEARS,
+		static_cast<double>(visited) / NUM_CLEARS);
+}
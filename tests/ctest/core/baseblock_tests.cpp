@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "x86/BaseblockEx.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+static std::vector<uptr> CollectLinks(const BaseBlockLinks& links, u32 pc)
+{
+	std::vector<uptr> ret;
+	links.ForEach(pc, [&ret](uptr jumpptr) { ret.push_back(jumpptr); });
+	std::sort(ret.begin(), ret.end());
+	return ret;
+}
+
+TEST(BaseBlockLinks, ChainsPerPC)
+{
+	BaseBlockLinks links;
+	links.Insert(0x1000, 1);
+	links.Insert(0x2000, 2);
+	links.Insert(0x1000, 3);
+
+	EXPECT_EQ(CollectLinks(links, 0x1000), (std::vector<uptr>{1, 3}));
+	EXPECT_EQ(CollectLinks(links, 0x2000), (std::vector<uptr>{2}));
+	EXPECT_TRUE(CollectLinks(links, 0x3000).empty());
+}
+
+TEST(BaseBlockLinks, SurvivesRehash)
+{
+	BaseBlockLinks links;
+	for (u32 i = 0; i < 0x10000; i++)
+		links.Insert(i * 4, i);
+
+	EXPECT_EQ(links.NodeCount(), 0x10000u);
+	for (u32 i = 0; i < 0x10000; i += 0x123)
+		EXPECT_EQ(CollectLinks(links, i * 4), (std::vector<uptr>{i}));
+}
+
+TEST(BaseBlockLinks, ClearDropsEverything)
+{
+	BaseBlockLinks links;
+	links.Insert(0x1000, 1);
+	links.Clear();
+
+	EXPECT_EQ(links.NodeCount(), 0u);
+	EXPECT_TRUE(CollectLinks(links, 0x1000).empty());
+
+	links.Insert(0x1000, 2);
+	EXPECT_EQ(CollectLinks(links, 0x1000), (std::vector<uptr>{2}));
+}
+
+TEST(BaseBlocks, RangeQueriesReachLongBlocks)
+{
+	BaseBlocks blocks;
+	blocks.SetSize(blocks.New(0x1000, 0), 0x2000 / 4);
+	blocks.SetSize(blocks.New(0x2800, 0), 4);
+	blocks.SetSize(blocks.New(0x8000, 0), 4);
+
+	// The long block reaches into the queried chunk, so the walk has to start there.
+	const int first = blocks.FirstIndexOverlapping(0x2c00);
+	ASSERT_GE(first, 0);
+	EXPECT_EQ(blocks[first]->startpc, 0x1000u);
+
+	// But it doesn't reach this far, so the query shouldn't look back past the chunk.
+	EXPECT_EQ(blocks[blocks.FirstIndexOverlapping(0x8010)]->startpc, 0x8000u);
+}
+
+TEST(BaseBlocks, RangeQueriesBelowFirstBlock)
+{
+	BaseBlocks blocks;
+	EXPECT_EQ(blocks[blocks.FirstIndexOverlapping(0x1000)], nullptr);
+
+	blocks.SetSize(blocks.New(0x2000, 0), 4);
+	blocks.SetSize(blocks.New(0x3000, 0), 4);
+
+	// Nothing starts at or below the range, so the walk starts at the first block, which is inside it.
+	EXPECT_EQ(blocks.FirstIndexOverlapping(0x1000), 0);
+}
+
+TEST(BaseBlocks, ResetClearsRangeIndex)
+{
+	BaseBlocks blocks;
+	blocks.SetSize(blocks.New(0x1000, 0), 0x2000 / 4);
+	blocks.Reset();
+
+	blocks.SetSize(blocks.New(0x1000, 0), 4);
+	blocks.SetSize(blocks.New(0x2800, 0), 4);
+	EXPECT_EQ(blocks[blocks.FirstIndexOverlapping(0x2c00)]->startpc, 0x2800u);
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Vif.h"
+#include "Vif_Dma.h"
+#include "Vif_Unpack.h"
+
+#include "common/Timer.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Write throughput of every unpack format, in difference mode with and without masking.
+TEST(VifUnpackBenchmark, Throughput)
+{
+	static constexpr uint NUM_QWC = 4096;
+	static constexpr uint PASSES = 64;
+	static constexpr const char* vn_names[] = {"S", "V2", "V3", "V4"};
+	static constexpr uint vl_bits[] = {32, 16, 8, 5};
+
+	std::vector<u8> src(NUM_QWC * 16 + 16);
+	std::vector<u128> dest(NUM_QWC);
+	std::mt19937 rng(1);
+	for (u8& v : src) v = static_cast<u8>(rng());
+
+	vif0.MaskRow = {};
+	vif0.MaskCol = {};
+	vif0Regs.mask = 0x1b1b1b1b;
+	vif0.cl = 0;
+
+	for (uint vn = 0; vn < 4; vn++)
+	{
+		for (uint vl = 0; vl < 4; vl++)
+		{
+			if (vl == 3 && vn != 3)
+				continue;
+
+			const uint src_size = (vl == 3) ? 2 : ((vn + 1) * (32 >> vl)) / 8;
+			for (uint masked = 0; masked < 2; masked++)
+			{
+				const UNPACKFUNCTYPE func = VIFfuncTable[0][2][masked * 16 + vn * 4 + vl];
+				Common::Timer timer;
+				for (uint pass = 0; pass < PASSES; pass++)
+				{
+					for (uint i = 0; i < NUM_QWC; i++)
+						func(&dest[i], &src[i * src_size]);
+				}
+				const double seconds = timer.GetTimeSeconds();
+				const double bytes = static_cast<double>(NUM_QWC) * PASSES * sizeof(u128);
+				std::printf("%s-%u%s: %.2f GB/s written\n", vn_names[vn], vl_bits[vl], masked ? " masked" : "",
+					seconds > 0.0 ? (bytes / seconds) / 1e9 : 0.0);
+			}
+		}
+	}
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Vif.h"
+#include "Vif_Dma.h"
+#include "Vif_Unpack.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	// One field at a time, the way the interpreter used to do it.
+	struct RefState
+	{
+		u32 row[4];
+		u32 col[4];
+		u32 mask;
+		int cl;
+	};
+
+	void RefWrite(RefState& st, uint mode, bool doMask, u32 field, u32& dest, u32 data)
+	{
+		const u32 n = doMask ? (st.mask >> (std::min(st.cl, 3) * 8 + field * 2)) & 3 : 0;
+		switch (n)
+		{
+			case 0:
+				switch (mode)
+				{
+					case 1: dest = data + st.row[field]; break;
+					case 2: dest = st.row[field] = st.row[field] + data; break;
+					case 3: dest = st.row[field] = data; break;
+					default: dest = data; break;
+				}
+				break;
+			case 1: dest = st.row[field]; break;
+			case 2: dest = st.col[std::min(st.cl, 3)]; break;
+			case 3: break;
+		}
+	}
+
+	// Reads element i of the source as the unpack would see it, before masking and mode.
+	u32 RefElement(const u8* src, uint vl, bool usn, uint i)
+	{
+		switch (vl)
+		{
+			case 0: { u32 v; std::memcpy(&v, src + i * 4, 4); return v; }
+			case 1: { u16 v; std::memcpy(&v, src + i * 2, 2); return usn ? v : static_cast<u32>(static_cast<s32>(static_cast<s16>(v))); }
+			default: return usn ? src[i] : static_cast<u32>(static_cast<s32>(static_cast<s8>(src[i])));
+		}
+	}
+
+	void RefUnpack(RefState& st, uint vn, uint vl, uint mode, bool usn, bool doMask, u32* dest, const u8* src)
+	{
+		u32 data[4];
+		if (vl == 3)
+		{
+			u32 v;
+			std::memcpy(&v, src, 4);
+			data[0] = (v & 0x001f) << 3;
+			data[1] = (v & 0x03e0) >> 2;
+			data[2] = (v & 0x7c00) >> 7;
+			data[3] = (v & 0x8000) >> 8;
+			mode = 0;
+		}
+		else if (vn == 0)
+		{
+			data[0] = data[1] = data[2] = data[3] = RefElement(src, vl, usn, 0);
+		}
+		else if (vn == 1)
+		{
+			data[0] = data[2] = RefElement(src, vl, usn, 0);
+			data[1] = data[3] = RefElement(src, vl, usn, 1);
+		}
+		else
+		{
+			for (uint i = 0; i < 4; i++)
+				data[i] = RefElement(src, vl, usn, i);
+		}
+
+		for (uint i = 0; i < 4; i++)
+			RefWrite(st, mode, doMask, i, dest[i], data[i]);
+	}
+
+	bool IsValidFormat(uint vn, uint vl)
+	{
+		return vl != 3 || vn == 3;
+	}
+
+	UNPACKFUNCTYPE GetUnpack(uint mode, bool usn, bool doMask, uint vn, uint vl)
+	{
+		return VIFfuncTable[0][mode][(usn * 2 + doMask) * 16 + vn * 4 + vl];
+	}
+
+	void LoadState(const RefState& st)
+	{
+		std::memcpy(vif0.MaskRow._u32, st.row, sizeof(st.row));
+		std::memcpy(vif0.MaskCol._u32, st.col, sizeof(st.col));
+		vif0Regs.mask = st.mask;
+		vif0.cl = st.cl;
+	}
+} // namespace
+
+TEST(VifUnpack, MatchesScalarReference)
+{
+	std::mt19937 rng(0x5f3759df);
+
+	for (uint mode = 0; mode < 4; mode++)
+	{
+		for (uint flags = 0; flags < 4; flags++)
+		{
+			const bool usn = flags & 2;
+			const bool doMask = flags & 1;
+			for (uint vn = 0; vn < 4; vn++)
+			{
+				for (uint vl = 0; vl < 4; vl++)
+				{
+					if (!IsValidFormat(vn, vl))
+						continue;
+
+					const UNPACKFUNCTYPE func = GetUnpack(mode, usn, doMask, vn, vl);
+					for (int iter = 0; iter < 64; iter++)
+					{
+						RefState st;
+						for (u32& v : st.row) v = rng();
+						for (u32& v : st.col) v = rng();
+						st.mask = rng();
+						st.cl = iter % 5;
+
+						alignas(16) u8 src[16];
+						for (u8& v : src) v = static_cast<u8>(rng());
+
+						alignas(16) u32 expected[4];
+						alignas(16) u32 actual[4];
+						for (uint i = 0; i < 4; i++)
+							expected[i] = actual[i] = rng();
+
+						LoadState(st);
+						func(actual, src);
+						RefUnpack(st, vn, vl, mode, usn, doMask, expected, src);
+
+						SCOPED_TRACE(testing::Message() << "mode=" << mode << " usn=" << usn << " mask=" << doMask
+														<< " vn=" << vn << " vl=" << vl << " cl=" << st.cl);
+						ASSERT_EQ(0, std::memcmp(expected, actual, sizeof(expected)));
+						ASSERT_EQ(0, std::memcmp(st.row, vif0.MaskRow._u32, sizeof(st.row)));
+					}
+				}
+			}
+		}
+	}
+}